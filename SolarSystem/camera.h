@@ -62,15 +62,15 @@ public:
 
 	void apply_object3d_orientation(const object3d *obj, const vector3<float> &offset) {
 		glTranslatef(offset.get_x(), offset.get_y(), offset.get_z());
-		eye_position = obj->get_position();
-		look_at = obj->get_position() + obj->get_forward();
-		up_vector = obj->get_up();
+		eye_position = obj->get_render_position();
+		look_at = obj->get_render_position() + obj->get_render_forward();
+		up_vector = obj->get_render_up();
 	}
 
 	void apply_planet_orientation(const object3d *obj, const vector3<float> &offset) {
-		eye_position = obj->get_position() + offset;
-		look_at = obj->get_position();
-		up_vector = obj->get_forward();
+		eye_position = obj->get_render_position() + offset;
+		look_at = obj->get_render_position();
+		up_vector = obj->get_render_forward();
 	}
 
 	void set_eye_position(float x, float y, float z) {
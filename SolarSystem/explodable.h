@@ -9,10 +9,42 @@
 #ifndef __SOLAR_SYSTEM_EXPLODABLE_H
 #define __SOLAR_SYSTEM_EXPLODABLE_H
 
+#include <cstddef>
+
+#include "vector3.h"
+#include "colors.h"
+#include "explosion_pool.h"
+
+/**
+ * Something that bursts into particles when destroyed. The burst lives
+ * in a shared explosion_pool, nothing happens until one is set.
+ */
 class explodable {
 public:
-	virtual void draw_explosion() = 0;
+	explodable():
+		explosions(NULL) {
+	}
+
 	virtual ~explodable() {}
+
+	void set_explosions(explosion_pool *pool) {
+		explosions = pool;
+	}
+
+	explosion_pool *get_explosions() const {
+		return explosions;
+	}
+
+protected:
+	void explode(const vector3<float> &center, float radius, const colors::color_name &c) {
+		if (explosions != NULL) {
+			const float *rgb = get_color(c);
+			explosions->spawn(center, radius, vector3<float>(rgb[0], rgb[1], rgb[2]));
+		}
+	}
+
+private:
+	explosion_pool *explosions;
 };
 
 #endif
@@ -0,0 +1,184 @@
+#ifndef __SOLAR_SYSTEM_EXPLOSION_POOL_H
+#define __SOLAR_SYSTEM_EXPLOSION_POOL_H
+
+#include <vector>
+#include <mutex>
+#include <cmath>
+#include <cstring>
+#include <cstddef>
+#include <stdint.h>
+
+#include "gl_platform.h"
+
+#include "vector3.h"
+#include "math3d.h"
+#include "particle_buffer.h"
+#include "vertex_stream.h"
+#include "random.h"
+
+using namespace std;
+using namespace util;
+
+/**
+ * Every explosion in the galaxy is a one-shot burst of particles out of
+ * one preallocated pool. Bursts move on simulation ticks, so they last
+ * the same time at any frame rate, and the whole pool is drawn with a
+ * single glDrawArrays() however many explosions are going on.
+ */
+class explosion_pool {
+
+public:
+    static const size_t DEFAULT_CAPACITY = 16384;
+    /* particles in one burst */
+    static const int BURST_PARTICLES = 384;
+    /* seconds a burst takes to reach its radius */
+    static constexpr float BURST_TIME = 0.8f;
+    /* side of a particle quad in world units */
+    static constexpr float PARTICLE_SIZE = 60.0f;
+
+public:
+    explicit explosion_pool(size_t capacity = DEFAULT_CAPACITY) :
+    built(false) {
+        particles.reserve(capacity);
+        vertices.resize(capacity * 4);
+    }
+
+    /**
+     * Start a burst of "count" particles flying out of "center" to about
+     * "radius" in BURST_TIME seconds. Particles that do not fit in the
+     * pool are dropped. Safe to call from several jobs at once.
+     */
+    void spawn(const vector3<float> &center, float radius, const vector3<float> &color, int count = BURST_PARTICLES) {
+        lock_guard<mutex> guard(lock);
+        // keyed by the place, not by the order jobs happen to call in
+        util::philox rng(0, stream_key(center));
+        const unsigned rgba = util::particle_buffer::pack_color(color[0], color[1], color[2]);
+        for (int k = 0; k < count && !particles.full(); k++) {
+            const size_t i = particles.spawn();
+            // uniform direction on the sphere
+            const float z = 1.0f - 2.0f * rng.next_float();
+            const float phi = 2.0f * util::constants::PI * rng.next_float();
+            const float r = sqrtf(fmaxf(0.0f, 1.0f - z * z));
+            const float speed = radius / BURST_TIME * (0.5f + 0.5f * rng.next_float());
+            particles.px[i] = center[0], particles.py[i] = center[1], particles.pz[i] = center[2];
+            particles.vx[i] = r * cosf(phi) * speed;
+            particles.vy[i] = r * sinf(phi) * speed;
+            particles.vz[i] = z * speed;
+            particles.age[i] = 0;
+            particles.life[i] = BURST_TIME * (0.75f + 0.5f * rng.next_float());
+            particles.gravity[i] = 0;
+            particles.rgba[i] = rgba;
+            particles.emitter[i] = 0;
+        }
+        built = false;
+    }
+
+    /**
+     * Advance every burst by dt seconds, one simulation tick
+     */
+    void update(float dt) {
+        if (particles.size() == 0) {
+            return;
+        }
+        if (util::step_particles(particles, 0, particles.size(), dt) > 0) {
+            util::remove_expired(particles);
+        }
+        built = false;
+    }
+
+    /**
+     * Draw every live particle as a quad facing the camera, blended on
+     * top of the scene without writing depth
+     */
+    void draw() {
+        const size_t n = particles.size();
+        if (n == 0) {
+            return;
+        }
+        float mv[16];
+        glGetFloatv(GL_MODELVIEW_MATRIX, mv);
+        const float axes[6] = { mv[0], mv[4], mv[8], mv[1], mv[5], mv[9] };
+        if (!built || memcmp(axes, camera_axes, sizeof(axes)) != 0) {
+            const vector3<float> right(axes[0], axes[1], axes[2]);
+            const vector3<float> up(axes[3], axes[4], axes[5]);
+            memcpy(camera_axes, axes, sizeof(axes));
+            build_vertices(right * (PARTICLE_SIZE / 2), up * (PARTICLE_SIZE / 2));
+            stream.upload(&vertices[0], n * 4 * sizeof(util::particle_vertex));
+            built = true;
+        }
+        glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); {
+            glDisable(GL_LIGHTING);
+            glDisable(GL_TEXTURE_2D);
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+            glDepthMask(GL_FALSE);
+            stream.bind();
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glEnableClientState(GL_COLOR_ARRAY);
+            glVertexPointer(3, GL_FLOAT, sizeof(util::particle_vertex), stream.data(offsetof(util::particle_vertex, x)));
+            glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(util::particle_vertex), stream.data(offsetof(util::particle_vertex, r)));
+            glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(n * 4));
+            glDisableClientState(GL_COLOR_ARRAY);
+            glDisableClientState(GL_VERTEX_ARRAY);
+            stream.unbind();
+            glDepthMask(GL_TRUE);
+        } glPopAttrib();
+    }
+
+    /**
+     * Number of live particles over all bursts
+     */
+    size_t size() const {
+        return particles.size();
+    }
+
+    void clear() {
+        particles.clear();
+        built = false;
+    }
+
+private:
+    void build_vertices(const vector3<float> &right, const vector3<float> &up) {
+        const size_t n = particles.size();
+        const vector3<float> corner[4] = { -right - up, right - up, right + up, -right + up };
+        util::particle_vertex *out = &vertices[0];
+        for (size_t i = 0; i < n; i++, out += 4) {
+            const unsigned c = particles.rgba[i];
+            const float fade = 1 - particles.age[i] / particles.life[i];
+            const unsigned char alpha = static_cast<unsigned char>((fade < 0 ? 0 : fade) * 255.0f);
+            for (int v = 0; v < 4; v++) {
+                util::particle_vertex &pv = out[v];
+                pv.x = particles.px[i] + corner[v][0];
+                pv.y = particles.py[i] + corner[v][1];
+                pv.z = particles.pz[i] + corner[v][2];
+                pv.r = c & 0xff;
+                pv.g = (c >> 8) & 0xff;
+                pv.b = (c >> 16) & 0xff;
+                pv.a = alpha;
+                pv.u = (v == 1 || v == 2) ? 1.0f : 0.0f;
+                pv.v = (v >= 2) ? 1.0f : 0.0f;
+            }
+        }
+    }
+
+    static uint64_t stream_key(const vector3<float> &p) {
+        uint32_t bits[3];
+        for (int k = 0; k < 3; k++) {
+            const float f = p[k];
+            memcpy(&bits[k], &f, sizeof(f));
+        }
+        return (static_cast<uint64_t>(bits[0] ^ (bits[2] << 16 | bits[2] >> 16)) << 32) | bits[1];
+    }
+
+private:
+    util::particle_buffer particles;
+    mutex lock;
+    // one camera facing quad per particle, rebuilt when the particles
+    // or the camera moved
+    vector<util::particle_vertex> vertices;
+    util::vertex_stream stream;
+    float camera_axes[6];
+    bool built;
+};
+
+#endif
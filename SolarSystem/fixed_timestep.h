@@ -0,0 +1,110 @@
+#ifndef __SOLAR_SYSTEM_FIXED_TIMESTEP_H
+#define __SOLAR_SYSTEM_FIXED_TIMESTEP_H
+
+#include <chrono>
+#include <cmath>
+
+namespace util {
+	/**
+	 * Accumulator based fixed-step scheduler.
+	 *
+	 * Each rendered frame calls advance(), which measures the wall time
+	 * since the previous frame with a monotonic clock and returns how many
+	 * simulation steps of get_step() milliseconds are due (0..max_steps).
+	 * The time left over is exposed as alpha() in [0, 1) so rendering can
+	 * interpolate between the last two simulation states.
+	 */
+	class fixed_timestep {
+	public:
+		typedef std::chrono::steady_clock clock;
+
+	public:
+		fixed_timestep(double step_ms = 40.0, int max_steps = 5):
+			step_ms(step_ms),
+			max_steps(max_steps),
+			accumulator(0.0),
+			started(false) {
+		}
+
+		/**
+		 * Change the simulation step, keeps the fraction of the
+		 * current step that has already elapsed
+		 */
+		void set_step(double ms) {
+			if (ms > 0.0 && ms != step_ms) {
+				accumulator = accumulator / step_ms * ms;
+				step_ms = ms;
+			}
+		}
+
+		double get_step() const {
+			return step_ms;
+		}
+
+		float get_step_seconds() const {
+			return static_cast<float>(step_ms / 1000.0);
+		}
+
+		void set_max_steps(int n) {
+			max_steps = n;
+		}
+
+		int get_max_steps() const {
+			return max_steps;
+		}
+
+		/**
+		 * Measure the frame time and return the number of steps to run
+		 */
+		int advance() {
+			clock::time_point now = clock::now();
+			if (!started) {
+				started = true;
+				last = now;
+				return 0;
+			}
+			double elapsed_ms = std::chrono::duration<double, std::milli>(now - last).count();
+			last = now;
+			return advance(elapsed_ms);
+		}
+
+		/**
+		 * Same as advance() with an explicit frame time, for replays and
+		 * deterministic runs
+		 */
+		int advance(double elapsed_ms) {
+			accumulator += elapsed_ms;
+			int steps = static_cast<int>(std::floor(accumulator / step_ms));
+			if (steps > max_steps) {
+				// the machine can't keep up: drop the backlog instead of
+				// spiralling, the simulation just runs slower for a moment
+				steps = max_steps;
+				accumulator = std::fmod(accumulator, step_ms);
+			} else {
+				accumulator -= steps * step_ms;
+			}
+			return steps;
+		}
+
+		/**
+		 * How far the wall clock is into the next step, in [0, 1)
+		 */
+		float alpha() const {
+			return static_cast<float>(accumulator / step_ms);
+		}
+
+		void reset() {
+			accumulator = 0.0;
+			started = false;
+		}
+
+	private:
+		double step_ms;
+		int max_steps;
+		double accumulator;
+		bool started;
+		clock::time_point last;
+	};
+}
+
+#endif
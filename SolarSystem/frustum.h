@@ -0,0 +1,96 @@
+#ifndef __SOLAR_SYSTEM_FRUSTUM_H
+#define __SOLAR_SYSTEM_FRUSTUM_H
+
+#include <cmath>
+
+#include "gl_platform.h"
+
+#include "vector3.h"
+
+namespace util {
+	/**
+	 * The six planes of a view volume in world space, pulled out of
+	 * projection * modelview (Gribb and Hartmann) right after the camera
+	 * was applied. Each plane is normalized with its normal pointing in,
+	 * so the signed distance of a point is a dot product away.
+	 */
+	class frustum {
+	public:
+		enum plane_index { LEFT, RIGHT, BOTTOM, TOP, NEAR_PLANE, FAR_PLANE, PLANE_COUNT };
+
+	public:
+		/**
+		 * Starts out accepting everything, until extract() is called
+		 */
+		frustum() {
+			for (int i = 0; i < PLANE_COUNT; ++i) {
+				planes[i][0] = planes[i][1] = planes[i][2] = 0.0f;
+				planes[i][3] = 1.0f;
+			}
+		}
+
+		/**
+		 * Planes of the current GL projection and modelview; call with only
+		 * the camera on the modelview stack to get them in world space
+		 */
+		void extract() {
+			float proj[16], mv[16];
+			glGetFloatv(GL_PROJECTION_MATRIX, proj);
+			glGetFloatv(GL_MODELVIEW_MATRIX, mv);
+			extract(proj, mv);
+		}
+
+		/**
+		 * Planes of the column-major matrices "proj" and "mv"
+		 */
+		void extract(const float proj[16], const float mv[16]) {
+			float clip[16];
+			for (int c = 0; c < 4; ++c) {
+				for (int r = 0; r < 4; ++r) {
+					clip[c * 4 + r] = proj[r] * mv[c * 4] + proj[4 + r] * mv[c * 4 + 1] +
+						proj[8 + r] * mv[c * 4 + 2] + proj[12 + r] * mv[c * 4 + 3];
+				}
+			}
+			// row r of clip is clip[r], clip[4 + r], clip[8 + r], clip[12 + r];
+			// the planes are row 3 plus or minus rows 0, 1 and 2
+			for (int i = 0; i < PLANE_COUNT; ++i) {
+				const int r = i / 2;
+				const float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+				float *p = planes[i];
+				for (int k = 0; k < 4; ++k) {
+					p[k] = clip[k * 4 + 3] + sign * clip[k * 4 + r];
+				}
+				const float length = sqrtf(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+				if (length > 0.0f) {
+					for (int k = 0; k < 4; ++k) {
+						p[k] /= length;
+					}
+				}
+			}
+		}
+
+		/**
+		 * False only when the sphere is entirely outside one of the planes.
+		 * Spheres near a corner may pass without being seen, never the
+		 * other way round.
+		 */
+		bool intersects(const vector3<float> &center, float radius) const {
+			for (int i = 0; i < PLANE_COUNT; ++i) {
+				const float *p = planes[i];
+				if (p[0] * center[0] + p[1] * center[1] + p[2] * center[2] + p[3] < -radius) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		const float *get_plane(int i) const {
+			return planes[i];
+		}
+
+	private:
+		float planes[PLANE_COUNT][4];	// a, b, c, d of ax + by + cz + d >= 0
+	};
+}
+
+#endif
@@ -26,9 +26,7 @@
 #include <cassert>
 #include <array>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "colors.h"
 #include "sun.h"
@@ -43,11 +41,19 @@
 #include "object3d.h"
 #include "string_util.h"
 #include "missile_moon.h"
+#include "explosion_pool.h"
 #include "shootable.h"
 #include "oracle.h"
 #include "torpedo.h"
 #include "torus.h"
-#include "special_model.h"
+#include "gravity_field.h"
+#include "sweep_and_prune.h"
+#include "job_system.h"
+#include "frustum.h"
+#include "render_queue.h"
+#include "gl_state.h"
+#include "skybox.h"
+#include "model_mesh.h"
 #import "galaxy_constants.h"
 
 using namespace colors;
@@ -57,8 +63,13 @@ const int TIME_QUANTUM[5] = {20, 40, 100, 250, 500};
 extern const int VERTICAL_TEXT_OFFSET = 20;
 extern const int GRAVITY = 90000000;
 extern const int GRAVITY_THRESHOLD = 1800;
+extern const float GRAVITY_THETA = 0.5f;
+extern const float SMALL_BODY_MASS = 1.0f;
 extern const int oo = 1000000000;
 extern const int TRACKING_FRAME = 50;
+/* depth range of the perspective views, the skybox does not need any */
+extern const double VIEW_NEAR = 10.0;
+extern const double VIEW_FAR = 200000.0;
 
 class galaxy {
 public:
@@ -91,6 +102,35 @@ public:
         SHIP_FOLLOWING	= 3
     };
 
+    /**
+     * What a broadphase collider is, picks the narrowphase handler
+     */
+    enum collider_role {
+        COLLIDER_BODY		= 0,
+        COLLIDER_MOON		= 1,
+        COLLIDER_TORPEDO	= 2,
+        COLLIDER_SHIP		= 3,
+        COLLIDER_TORUS		= 4
+    };
+
+    /**
+     * Broadphase layers, a pair is tested only if one side's mask
+     * contains the other side's layer
+     */
+    enum collider_layer {
+        LAYER_BODY			= 1 << 0,
+        LAYER_OBSTACLE		= 1 << 1,
+        LAYER_SHIP			= 1 << 2,
+        LAYER_ENEMY_TORPEDO	= 1 << 3,
+        LAYER_SHIP_TORPEDO	= 1 << 4
+    };
+
+    struct collider {
+        object3d *object;
+        collider_role role;
+        torpedo **slot;     // torpedoes are replaced when fired, follow the slot
+    };
+
     enum planet_camera_type {
         DYANMIC_UNUM		= 0,
         DYANMIC_DUO			= 1,
@@ -143,15 +183,20 @@ public:
     fps(0) {
 
         setup_texture_objects(hm);
+        gravity.set_theta(GRAVITY_THETA);
 
         // set up environment
         setup_planets();
+        setup_orbits();
         setup_oracles();
         setup_toruses();
         setup_lights();
         setup_cameras();
         setup_smart_torpedo();
         setup_spaceship_followers();
+        setup_explosions();
+        setup_colliders();
+        setup_update_jobs();
         // sound::play_background();
 
         g2v_star->add_affected_objects(&unum_smart_torpedo);
@@ -177,23 +222,15 @@ public:
     }
 
     /**
-     * Compute the gravity vector and force
-     * TODO: fix divide by zero bug! 11/20/2012
+     * Compute the gravity vector and force from the last gravity field,
+     * see build_gravity_field()
      */
     pair<vector3<float>, float> get_gravity_vector_and_force(vector3<float> at_pos) const {
-        pair<vector3<float>, float> result;
-        double distance = math3d::distance(vector3<float>(0, 0, 0), at_pos);
-        double force = 0.0f;
-        if (distance < GRAVITY_THRESHOLD) {
-            force = 0.0f;
-        } else {
-            force = static_cast<double>(GRAVITY)/(distance * distance);
-        }
+        return gravity.field_at(at_pos);
+    }
 
-        vector3<float> sun_vector(0, 0, 0);
-        vector3<float> gravity_vector = sun_vector - at_pos;
-        gravity_vector.normalize();
-        return pair<vector3<float>, float>(gravity_vector * force, force);
+    util::gravity_field &get_gravity_field() {
+        return gravity;
     }
 
     bool is_gravity_on() const {
@@ -201,10 +238,21 @@ public:
     }
 
     /**
-     * Generate all models for display list
+     * Load the ship model every spaceship shares; ships without it
+     * are drawn as primitives
      */
     void generate_models() {
-        special_model::generate_spaceship_model(1, 100.0f);
+        // the display list used to turn this on for good, scaled
+        // objects drawn with glScalef() still rely on it
+        glEnable(GL_NORMALIZE);
+        if (!warbird.load("warbird.mesh", 100.0f)) {
+            cerr << "cannot load warbird.mesh, ships are drawn as primitives" << endl;
+            return;
+        }
+        apollo->set_model(&warbird);
+        for (size_t i = 0; i < followers.size(); ++i) {
+            followers[i]->set_model(&warbird);
+        }
     }
 
     /**
@@ -216,7 +264,7 @@ public:
         glMatrixMode(GL_PROJECTION);
         glLoadIdentity();
         if (m == PERSPECTIVE) {
-            gluPerspective(view_angle, (float)w/h, 10.0, 900000.0);
+            gluPerspective(view_angle, (float)w/h, VIEW_NEAR, VIEW_FAR);
         } else {
             glOrtho(-w/2, w, -h/2, h, -1.0, 1.0);
         }
@@ -228,6 +276,7 @@ public:
      */
     void draw() {
         fps++;
+        util::lod::set_view(0);
         if (!on_planet_camera) {
             draw_with_camera(camera_index);
         } else {
@@ -239,30 +288,75 @@ public:
      * Draw all objects in scene
      */
     void draw_all() {
+        // draw galaxy with texture, first since it writes no depth
+        sky.draw(st_idx);
         // display game status
         draw_game_status();
-        // draw galaxy with texture
-        draw_galaxy_skybox(100000);
         // draw light
         led->draw();
+        // everything else is queued and drawn sorted by state, copies
+        // of the same mesh together in one draw
+        queue.begin();
+        instances.begin();
         // draw the sun
-        g2v_star->draw();
-        // draw particles
-        engine->draw();
+        if (view.intersects(g2v_star->get_render_position(), g2v_star->get_draw_radius())) {
+            queue.submit(g2v_star->get_render_state(), [this]() { g2v_star->draw(); });
+        }
+        // draw particles, they sit around the origin
+        if (view.intersects(vector3<float>(0, 0, 0), engine->get_draw_radius())) {
+            queue.submit(engine->get_render_state(), [this]() { engine->draw(); });
+        } else {
+            engine->skip_draw();
+        }
         // draw moving spaceship, real!
-        apollo->draw();
+        submit_spaceship(apollo);
         // draw all ship's partners
         for_each(followers.begin(), followers.end(), [&](spaceship *sp) {
-            sp->draw();
+            submit_spaceship(sp);
         });
 
-        // draw smart torpedo
-        unum_smart_torpedo->draw();
-        tres_smart_torpedo->draw();
-        ship_smart_torpedo->draw();
+        // draw smart torpedo, never culled: the line to the target
+        // can cross the view from anywhere
+        unum_smart_torpedo->submit(instances);
+        tres_smart_torpedo->submit(instances);
+        ship_smart_torpedo->submit(instances);
+        queue.submit(util::render_state(), [this]() {
+            unum_smart_torpedo->draw_guides();
+            tres_smart_torpedo->draw_guides();
+            ship_smart_torpedo->draw_guides();
+        });
+
+        // a planet out of view can still have a moon in it
+        for_each(planets.begin(), planets.end(), [&](planet *p) {
+            if (view.intersects(p->get_render_position(), p->get_system_radius())) {
+                p->submit(queue, instances, view);
+            }
+        });
+        for_each(toruses.begin(), toruses.end(), [&](torus *t) {
+            if (view.intersects(t->get_render_position(), t->get_enclosing_radius())) {
+                queue.submit(util::render_state(), [t]() { t->draw(); });
+            }
+        });
+        queue.submit(util::render_state(), [this]() { instances.flush(); });
+        // the skybox and the light went straight to GL
+        gl.invalidate();
+        queue.flush(gl);
+        // blended last, over everything opaque
+        explosions.draw();
+    }
 
-        for_each(planets.begin(), planets.end(), [&](planet *p) { p->draw(); });
-        for_each(toruses.begin(), toruses.end(), [&](torus *t) { t->draw(); });
+    /**
+     * Queue a ship if it is in view; a culled one still drops its
+     * moving flag like draw() does
+     */
+    void submit_spaceship(spaceship *sp) {
+        if (view.intersects(sp->get_render_position(), sp->get_bounding_sphere_radius())) {
+            if (!sp->submit(instances)) {
+                queue.submit(util::render_state(), [sp]() { sp->draw(); });
+            }
+        } else {
+            sp->set_moving(false);
+        }
     }
 
     void draw_game_status() {
@@ -306,6 +400,8 @@ public:
                 cameras[index]->apply_object3d_orientation(apollo, offset);
             }
             cameras[index]->capture();
+            // cull against this camera
+            view.extract();
             // draw all objects
             draw_all();
             // restore transformation
@@ -327,6 +423,7 @@ public:
             planet_cameras[index]->apply_planet_orientation(planets[index], galaxy_constants::camera_view::moving::planet_cameras[index]);
             // capture the scene
             planet_cameras[index]->capture();
+            view.extract();
             // draw all planets
             draw_all();
             // restore transformation
@@ -339,6 +436,8 @@ public:
      * Draw with camera on top
      */
     void draw_top() {
+        // the top window keeps its own detail levels
+        util::lod::set_view(1);
         draw_with_camera(default_camera_type::SHIP_FOLLOWING);
     }
 
@@ -346,26 +445,96 @@ public:
      * Display all information
      */
     void draw_galaxy_info() {
+        // the field is only built in steps with gravity on, and the
+        // panel must not read one left over from before a toggle
+        if (info_mode == information_mode::INFO_GRAVITY) {
+            build_gravity_field();
+        }
         draw_info(-90, 20, 0);
         // reset fps
         fps = 0;
     }
 
     /**
-     * Update all objects
+     * Advance the simulation by one fixed step of get_time_quantum() ms
      */
     void update() {
+        // keep the previous state around for interpolated drawing
+        for_each_object([](object3d *o) { o->save_state(); });
+
+        jobs.run(update_jobs);
+        // outside the graph, the fountain spreads its own chunks over the workers
+        engine->update(get_time_quantum() / 1000.0f);
+        explosions.update(get_time_quantum() / 1000.0f);
+    }
+
+    util::job_system &get_job_system() {
+        return jobs;
+    }
+
+    /**
+     * Blend every object between the last two simulation steps,
+     * alpha is the fraction of the next step that has already elapsed
+     */
+    void interpolate(float alpha) {
+        for_each_object([=](object3d *o) { o->interpolate(alpha); });
+    }
+
+    /**
+     * Visit every simulated object, including moons and
+     * whichever torpedoes are currently in flight
+     */
+    template <typename F>
+    void for_each_object(F f) {
+        for (unsigned i = 0; i < planets.size(); ++i) {
+            f(planets[i]);
+            const vector<moon*> &moons = planets[i]->get_moons();
+            for_each(moons.begin(), moons.end(), [&](moon *m) { f(m); });
+        }
+        for_each(toruses.begin(), toruses.end(), [&](torus *t) { f(t); });
+        for_each(oracles.begin(), oracles.end(), [&](oracle *o) { f(o); });
+        for_each(followers.begin(), followers.end(), [&](spaceship *sp) { f(sp); });
+        f(g2v_star);
+        f(apollo);
+        f(unum_smart_torpedo);
+        f(tres_smart_torpedo);
+        f(ship_smart_torpedo);
+    }
+
+    /**
+     * update() as a job graph: orbits, obstacles, particles and ships
+     * are independent and run in parallel, the torpedoes need the moons
+     * and the ship, collisions need everything that moves, gravity
+     * comes last
+     */
+    void setup_update_jobs() {
+        int orbit = update_jobs.add([this] { update_orbits(); });
+        int obstacles = update_jobs.add([this] {
+            for_each(toruses.begin(), toruses.end(), [&](torus *t) {
+                t->update();
+            });
+            g2v_star->update();
+        });
+        int ships = update_jobs.add([this] { update_ships(); });
+        int shootables = update_jobs.add([this] { update_shootable_objects(); }, { orbit, ships });
+        int collisions = update_jobs.add([this] { update_collidable_objects(); }, { orbit, obstacles, shootables });
+        update_jobs.add([this] {
+            // if gravity is on, apply for all movable objects
+            if (gravity_on) {
+                apply_gravity();
+            }
+        }, { collisions });
+    }
+
+    void update_orbits() {
+        // advance every planet and moon orbit in one batch
+        orbits.update();
         for_each(planets.begin(), planets.end(), [&](planet *p) {
             p->update();
         });
-        for_each(toruses.begin(), toruses.end(), [&](torus *t) {
-            t->update();
-        });
-
-        // update non-moving objects
-        engine->update();
-        g2v_star->update();
+    }
 
+    void update_ships() {
         // update spaceship only if it's alive
         if (apollo->is_alive()) {
             apollo->update();
@@ -376,97 +545,165 @@ public:
                 sp->update();
             });
         }
-
-        update_shootable_objects();
-        update_collidable_objects();
-
-        // if gravity is on, apply for all movable objects
-        if (gravity_on) {
-            apply_gravity();
-        }
     }
 
     /**
-     * Update all collidable objects
+     * Update all collidable objects: refresh the broadphase with the
+     * current bounding spheres and run the narrowphase on its pairs only
      */
     void update_collidable_objects() {
-        vector3<float> parent_position(0, 0, 0);
         for (unsigned i = 0; i < planets.size(); ++i) {
-            handle_torpedo_collision(unum_smart_torpedo, planets[i]);
-            handle_torpedo_collision(tres_smart_torpedo, planets[i]);
-            handle_torpedo_collision(ship_smart_torpedo, planets[i]);
-
-            handle_spaceship_collision(apollo, planets[i]);
-            // get all moons of planets[i]
-            vector<moon*> moons = planets[i]->get_moons();
-            // get planets[i] position
-            parent_position = planets[i]->get_position();
-            // now check collision with respect to the world coordinate
+            const vector<moon*> &moons = planets[i]->get_moons();
             for (unsigned j = 0; j < moons.size(); ++j) {
-                // update parent position
                 moons[j]->set_parent_position(planets[i]->get_position());
-                handle_moon_vs_torpedo(moons[j], unum_smart_torpedo);
-                handle_moon_vs_torpedo(moons[j], tres_smart_torpedo);
-                if (moons[j]->get_name() == "U.Missile" || moons[j]->get_name() == "T.Missile") {
-                    handle_ship_smart_torpedo_collision(ship_smart_torpedo, (missile_moon*&)moons[j]);
+            }
+        }
+        for (unsigned id = 0; id < colliders.size(); ++id) {
+            if (colliders[id].slot != NULL) {
+                colliders[id].object = *colliders[id].slot;
+            }
+            // enclose the whole move since the last step for the swept tests
+            const object3d *o = colliders[id].object;
+            vector3<float> from = o->get_previous_enclosing_center();
+            vector3<float> to = o->get_enclosing_center();
+            broadphase.set_sphere(id, (from + to) * 0.5f, o->get_enclosing_radius() + (to - from).length() * 0.5f);
+        }
+        const vector<util::sweep_and_prune::id_pair> &pairs = broadphase.find_pairs();
+        for (unsigned i = 0; i < pairs.size(); ++i) {
+            handle_collision(colliders[pairs[i].first], colliders[pairs[i].second]);
+        }
+    }
+
+    /**
+     * Narrowphase for one broadphase pair, a was registered before b
+     */
+    void handle_collision(const collider &a, const collider &b) {
+        switch (b.role) {
+            case COLLIDER_TORPEDO: {
+                torpedo *torpe = static_cast<torpedo*>(b.object);
+                if (a.role == COLLIDER_MOON) {
+                    moon *m = static_cast<moon*>(a.object);
+                    if (torpe == ship_smart_torpedo && (m->get_name() == "U.Missile" || m->get_name() == "T.Missile")) {
+                        missile_moon *mm = static_cast<missile_moon*>(m);
+                        handle_ship_smart_torpedo_collision(torpe, mm);
+                    } else {
+                        handle_moon_vs_torpedo(m, torpe);
+                    }
                 } else {
-                    handle_moon_vs_torpedo(moons[j], ship_smart_torpedo);
+                    handle_torpedo_collision(torpe, a.object);
                 }
-                handle_moon_vs_spaceship(moons[j], apollo);
+                break;
+            }
+            case COLLIDER_SHIP: {
+                if (a.role == COLLIDER_MOON) {
+                    moon *m = static_cast<moon*>(a.object);
+                    handle_moon_vs_spaceship(m, apollo);
+                } else if (a.role == COLLIDER_TORPEDO) {
+                    torpedo *torpe = static_cast<torpedo*>(a.object);
+                    if (torpe->is_alive() && apollo->is_alive() && hits(apollo, torpe)) {
+                        torpe->destroy();
+                        apollo->destroy();
+                    }
+                } else {
+                    handle_spaceship_collision(apollo, a.object);
+                }
+                break;
+            }
+            case COLLIDER_BODY: {
+                // only the sun comes after the ship
+                if (a.role == COLLIDER_TORPEDO) {
+                    torpedo *torpe = static_cast<torpedo*>(a.object);
+                    handle_torpedo_collision(torpe, b.object);
+                } else {
+                    handle_spaceship_collision(apollo, b.object);
+                }
+                break;
+            }
+            case COLLIDER_TORUS: {
+                if (apollo->is_alive() && hits(b.object, apollo)) {
+                    apollo->destroy();
+                }
+                break;
             }
+            default:
+                break;
         }
+    }
 
-        // spaceship vs. torpedoes
-        if (unum_smart_torpedo->is_alive() && apollo->is_alive() && apollo->collide_with(unum_smart_torpedo)) {
-            unum_smart_torpedo->destroy();
-            apollo->destroy();
+    /**
+     * Register every collidable with the broadphase. Pairs come out in
+     * registration order, which keeps the old narrowphase order: planets
+     * and their moons, the torpedoes, the warbird, the sun, the toruses.
+     */
+    void setup_colliders() {
+        const unsigned movers = LAYER_SHIP | LAYER_ENEMY_TORPEDO | LAYER_SHIP_TORPEDO;
+        for (unsigned i = 0; i < planets.size(); ++i) {
+            add_collider(planets[i], COLLIDER_BODY, LAYER_BODY, movers);
+            const vector<moon*> &moons = planets[i]->get_moons();
+            for (unsigned j = 0; j < moons.size(); ++j) {
+                add_collider(moons[j], COLLIDER_MOON, LAYER_BODY, movers);
+            }
         }
+        add_torpedo_collider(&unum_smart_torpedo, LAYER_ENEMY_TORPEDO, LAYER_BODY | LAYER_SHIP);
+        add_torpedo_collider(&tres_smart_torpedo, LAYER_ENEMY_TORPEDO, LAYER_BODY | LAYER_SHIP);
+        add_torpedo_collider(&ship_smart_torpedo, LAYER_SHIP_TORPEDO, LAYER_BODY);
+        add_collider(apollo, COLLIDER_SHIP, LAYER_SHIP, LAYER_BODY | LAYER_OBSTACLE | LAYER_ENEMY_TORPEDO);
+        add_collider(g2v_star, COLLIDER_BODY, LAYER_BODY, movers);
+        for_each(toruses.begin(), toruses.end(), [&](torus *t) {
+            add_collider(t, COLLIDER_TORUS, LAYER_OBSTACLE, LAYER_SHIP);
+        });
+    }
 
-        if (tres_smart_torpedo->is_alive() && apollo->is_alive() && apollo->collide_with(tres_smart_torpedo)) {
-            tres_smart_torpedo->destroy();
-            apollo->destroy();
-        }
+    void add_collider(object3d *o, collider_role role, unsigned layer, unsigned mask) {
+        collider c;
+        c.object = o;
+        c.role = role;
+        c.slot = NULL;
+        broadphase.add(layer, mask);
+        colliders.push_back(c);
+    }
 
-        handle_torpedo_collision(unum_smart_torpedo, g2v_star);
-        handle_torpedo_collision(tres_smart_torpedo, g2v_star);
-        handle_torpedo_collision(ship_smart_torpedo, g2v_star);
-        handle_spaceship_collision(apollo, g2v_star);
+    void add_torpedo_collider(torpedo **slot, unsigned layer, unsigned mask) {
+        add_collider(*slot, COLLIDER_TORPEDO, layer, mask);
+        colliders.back().slot = slot;
+    }
 
-        for_each(toruses.begin(), toruses.end(), [&](torus *t) {
-            if (apollo->is_alive() && t->collide_with(apollo)) {
-                apollo->destroy();
-            }
-        });
+    /**
+     * Swept narrowphase: did a and b touch at any time during the last step
+     */
+    static bool hits(const object3d *a, const object3d *b) {
+        float toi;
+        return a->sweep_with(b, toi);
     }
 
     void handle_ship_smart_torpedo_collision(torpedo *&torpe, missile_moon *&m) {
-        if (torpe->is_alive() && m->is_alive() && m->collide_with(torpe)) {
+        if (torpe->is_alive() && m->is_alive() && hits(m, torpe)) {
             m->destroy();
             torpe->destroy();
         }
     }
 
     void handle_moon_vs_torpedo(moon *&m, torpedo *&torpe) {
-        if (m->collide_with(torpe)) {
+        if (hits(m, torpe)) {
             torpe->destroy();
         }
     }
 
     void handle_moon_vs_spaceship(moon *&m, spaceship *&sp) {
-        if (m->collide_with(sp)) {
+        if (hits(m, sp)) {
             sp->destroy();
         }
     }
 
     void handle_torpedo_collision(torpedo *&torpe, const object3d *other) {
-        if (torpe->is_alive() && torpe->collide_with(other)) {
+        if (torpe->is_alive() && hits(torpe, other)) {
             cout << torpe->get_name() << " collides with " << other->get_name() << endl;
             torpe->destroy();
         }
     }
 
     void handle_spaceship_collision(spaceship *&ship, const object3d *other) {
-        if (ship->is_alive() && ship->collide_with(other)) {
+        if (ship->is_alive() && hits(ship, other)) {
             cout << ship->get_name() << " collides with " << other->get_name() << endl;
             ship->destroy();
         }
@@ -685,18 +922,33 @@ public:
         set_viewing_volume(viewing_mode::PERSPECTIVE, 1, 1);
     }
 
+    /**
+     * Squared distance from the warbird to every shootable moon, in
+     * shootable_objects order
+     */
+    void get_target_distances_squared(vector<float> &distances) const {
+        const size_t n = shootable_objects.size();
+        distances.resize(n);
+        if (n == 0) {
+            return;
+        }
+        vector<vector3<float> > positions(n);
+        for (size_t i = 0; i < n; ++i) {
+            positions[i] = shootable_objects[i]->get_parent_position() + shootable_objects[i]->get_position();
+        }
+        math3d::distance_squared(&positions[0], n, apollo->get_position(), &distances[0]);
+    }
+
     void handle_fire_event() {
         // why don't we do this when fire?
         int closest_id = -1;
-        double distance_to_moon;
-        double closest_distance = oo;
+        float closest_distance = numeric_limits<float>::max();
+        vector<float> distances;
+        get_target_distances_squared(distances);
         for (unsigned i = 0; i < shootable_objects.size(); ++i) {
-            if (shootable_objects[i]->is_alive()) {
-                distance_to_moon = math3d::distance(apollo->get_position(), shootable_objects[i]->get_parent_position() + shootable_objects[i]->get_position());
-                if (distance_to_moon < closest_distance) {
-                    closest_distance = distance_to_moon;
-                    closest_id = i;
-                }
+            if (shootable_objects[i]->is_alive() && distances[i] < closest_distance) {
+                closest_distance = distances[i];
+                closest_id = i;
             }
         }
 
@@ -825,7 +1077,7 @@ private:
         apollo->toggle_bounding_sphere(bounding_sphere_mode);
         for (unsigned i = 0; i < planets.size(); ++i) {
             planets[i]->toggle_bounding_sphere(bounding_sphere_mode);
-            vector<moon*> moons = planets[i]->get_moons();
+            const vector<moon*> &moons = planets[i]->get_moons();
             for (unsigned j = 0; j < moons.size(); ++j) {
                 moons[j]->toggle_bounding_sphere(bounding_sphere_mode);
             }
@@ -843,118 +1095,57 @@ private:
         for_each(toruses.begin(), toruses.end(), [&](torus *t) { t->toggle_bounding_sphere(bounding_sphere_mode); });
     }
 
+    /**
+     * Rebuild the gravity field: the sun, every planet and moon, the
+     * warbird and the torpedoes all attract each other
+     */
+    void build_gravity_field() {
+        using namespace galaxy_constants;
+        gravity.clear();
+        gravity.add(vector3<float>(0, 0, 0), static_cast<float>(GRAVITY), static_cast<float>(GRAVITY_THRESHOLD));
+        // planets and moons in orbit store order, see setup_orbits()
+        int index = 0;
+        for (unsigned i = 0; i < planets.size(); ++i) {
+            add_gravity_body(planets[i], orbits.get_world_position(index++));
+            const vector<moon*> &moons = planets[i]->get_moons();
+            for (unsigned j = 0; j < moons.size(); ++j) {
+                add_gravity_body(moons[j], orbits.get_world_position(index++));
+            }
+        }
+        if (apollo->is_alive()) {
+            gravity.add(apollo->get_absolute_position(), SMALL_BODY_MASS, apollo->get_bounding_sphere_radius());
+        }
+        torpedo *torpedoes[] = { unum_smart_torpedo, tres_smart_torpedo, ship_smart_torpedo };
+        for (int i = 0; i < 3; ++i) {
+            if (torpedoes[i]->is_alive()) {
+                gravity.add(torpedoes[i]->get_position(), SMALL_BODY_MASS, torpedoes[i]->get_bounding_sphere_radius());
+            }
+        }
+        gravity.build();
+    }
+
     /**
      * Apply gravity to all moving objects: spaceship, torpedo
      */
     void apply_gravity() {
-        pair<vector3<float>, float> gravity;
+        build_gravity_field();
         if (apollo->is_alive()) {
-            gravity = get_gravity_vector_and_force(apollo->get_absolute_position());
-            apollo->apply_gravity(gravity.first);
+            apollo->apply_gravity(gravity.acceleration_at(apollo->get_absolute_position()));
         }
         if (unum_smart_torpedo->is_alive()) {
-            gravity = get_gravity_vector_and_force(unum_smart_torpedo->get_position());
-            unum_smart_torpedo->apply_gravity(gravity.first);
+            unum_smart_torpedo->apply_gravity(gravity);
         }
         if (tres_smart_torpedo->is_alive()) {
-            gravity = get_gravity_vector_and_force(tres_smart_torpedo->get_position());
-            tres_smart_torpedo->apply_gravity(gravity.first);
+            tres_smart_torpedo->apply_gravity(gravity);
         }
         if (ship_smart_torpedo->is_alive()) {
-            gravity = get_gravity_vector_and_force(ship_smart_torpedo->get_position());
-            ship_smart_torpedo->apply_gravity(gravity.first);
+            ship_smart_torpedo->apply_gravity(gravity);
         }
     }
 
 
 private:
 
-    void draw_galaxy_skybox(int length) {
-        float size = 1.0f;
-        glDisable(GL_LIGHTING);
-        glDisable(GL_NORMALIZE);
-        glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, space_textures[st_idx]);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        // glColor3fv(get_color(white));
-        glBegin(GL_QUADS); {
-            // Negative X
-            {
-                glTexCoord2f(0, 0);
-                glVertex3f(-length, -length, length);
-                glTexCoord2f(1, 0);
-                glVertex3f(-length, -length, -length);
-                glTexCoord2f(1, 1);
-                glVertex3f(-length, length, -length);
-                glTexCoord2f(0, 1);
-                glVertex3f(-length, length, length);
-            }
-
-            //  Positive X
-            {
-                glTexCoord2f(0, 0);
-                glVertex3f(length, -length, -length);
-                glTexCoord2f(1, 0);
-                glVertex3f(length, -length, length);
-                glTexCoord2f(1, 1);
-                glVertex3f(length, length, length);
-                glTexCoord2f(0, 1);
-                glVertex3f(length, length, -length);
-            }
-
-            // Negative Z
-            {
-                glTexCoord2f(0, 0);
-                glVertex3f(-length, -length, -length);
-                glTexCoord2f(1, 0);
-                glVertex3f(length, -length, -length);
-                glTexCoord2f(1, 1);
-                glVertex3f(length, length, -length);
-                glTexCoord2f(0, 1);
-                glVertex3f(-length, length, -length);
-            }
-
-            // Positive Z
-            {
-                glTexCoord2f(0, 0);
-                glVertex3f(length, -length, length);
-                glTexCoord2f(1, 0);
-                glVertex3f(-length, -length, length);
-                glTexCoord2f(1, 1);
-                glVertex3f(-length, length, length);
-                glTexCoord2f(0, 1);
-                glVertex3f(length, length, length);
-            }
-
-            // Positive Y
-            {
-                glTexCoord2f(0, 0);
-                glVertex3f(-length, length, length);
-                glTexCoord2f(1, 0);
-                glVertex3f(-length, length, -length);
-                glTexCoord2f(1, 1);
-                glVertex3f(length, length, -length);
-                glTexCoord2f(0, 1);
-                glVertex3f(length, length, length);
-            }
-
-            // Negative Y
-            {
-                glTexCoord2f(0, 0);
-                glVertex3f(-length, -length, -length);
-                glTexCoord2f(1, 0);
-                glVertex3f(-length, -length, length);
-                glTexCoord2f(1, 1);
-                glVertex3f(length, -length, length);
-                glTexCoord2f(0, 1);
-                glVertex3f(length, -length, -length);
-            }
-        } glEnd();
-        glDisable(GL_TEXTURE_2D);
-        glEnable(GL_LIGHTING);
-    }
-
     void draw_intro_info(int x, int y, int z) const {
         glDisable(GL_LIGHTING);
         glColor3fv(get_color(black));
@@ -1036,7 +1227,7 @@ private:
             y_offset -= VERTICAL_TEXT_OFFSET;
             draw_text(planets[i]->get_position_string(), x, y_offset, z);
 
-            vector<moon*> moons = planets[i]->get_moons();
+            const vector<moon*> &moons = planets[i]->get_moons();
             for (int j = 0; j < moons.size(); ++j) {
                 y_offset -= VERTICAL_TEXT_OFFSET;
                 draw_text(moons[j]->get_name(), x, y_offset, z);
@@ -1192,13 +1383,13 @@ private:
 
         draw_text("distance from spaceship: ", x, y_offset, z);
         y_offset -= VERTICAL_TEXT_OFFSET;
-        double distance_to_moon = 0.0f;
         if (apollo->is_alive()) {
-            for (int i = 0; i < shootable_objects.size(); ++i) {
-                distance_to_moon = math3d::distance(apollo->get_position(), shootable_objects[i]->get_parent_position() + shootable_objects[i]->get_position());
+            vector<float> distances;
+            get_target_distances_squared(distances);
+            for (unsigned i = 0; i < shootable_objects.size(); ++i) {
                 draw_text("+ to: " + shootable_objects[i]->get_name(), x, y_offset, z);
                 y_offset -= VERTICAL_TEXT_OFFSET;
-                draw_text(util::to_string(distance_to_moon), x, y_offset, z);
+                draw_text(util::to_string(sqrt(distances[i])), x, y_offset, z);
                 y_offset -= VERTICAL_TEXT_OFFSET;
             }
         }
@@ -1375,24 +1566,41 @@ private:
         // g2v_star->add_affected_objects(apollo);
 
         engine = new particle_engine("firework", par_tid, 5000.0f, 4.5f);
-
-        space_textures.push_back(textures.find("galaxy0.bmp")->second);
-        space_textures.push_back(textures.find("galaxy1.bmp")->second);
-        space_textures.push_back(textures.find("galaxy2.bmp")->second);
-        space_textures.push_back(textures.find("galaxy3.bmp")->second);
-        space_textures.push_back(textures.find("galaxy4.bmp")->second);
-        space_textures.push_back(textures.find("galaxy5.bmp")->second);
-        space_textures.push_back(textures.find("galaxy6.bmp")->second);
-        space_textures.push_back(textures.find("galaxy7.bmp")->second);
-        space_textures.push_back(textures.find("galaxy8.bmp")->second);
-        space_textures.push_back(textures.find("galaxy9.bmp")->second);
-        space_textures.push_back(textures.find("galaxy10.bmp")->second);
-        space_textures.push_back(textures.find("messi.bmp")->second);
+        engine->set_job_system(&jobs);
+
+        add_sky(textures, "galaxy0.bmp");
+        add_sky(textures, "galaxy1.bmp");
+        add_sky(textures, "galaxy2.bmp");
+        add_sky(textures, "galaxy3.bmp");
+        add_sky(textures, "galaxy4.bmp");
+        add_sky(textures, "galaxy5.bmp");
+        add_sky(textures, "galaxy6.bmp");
+        add_sky(textures, "galaxy7.bmp");
+        add_sky(textures, "galaxy8.bmp");
+        add_sky(textures, "galaxy9.bmp");
+        add_sky(textures, "galaxy10.bmp");
+        add_sky(textures, "messi.bmp");
 
         st_idx = 0;
         planet_texture_id = textures.find("galaxy0.bmp")->second;
     }
 
+    /**
+     * Add the sky texture "name" to space_textures and its faces to the
+     * skybox; faces without their own image (see util::skybox::face_file)
+     * show the whole texture
+     */
+    void add_sky(const unordered_map<string, unsigned> &textures, const string &name) {
+        const unsigned whole = textures.find(name)->second;
+        GLuint faces[util::skybox::FACE_COUNT];
+        for (int f = 0; f < util::skybox::FACE_COUNT; ++f) {
+            unordered_map<string, unsigned>::const_iterator it = textures.find(util::skybox::face_file(name, f));
+            faces[f] = (it != textures.end()) ? it->second : whole;
+        }
+        space_textures.push_back(whole);
+        sky.add(faces);
+    }
+
     void setup_planets() {
         using namespace galaxy_constants;
         planet *unum = new planet(unum::name, unum::radius, unum::degree, unum::position, colors::white, planet_texture_id); {
@@ -1432,6 +1640,39 @@ private:
         planets.push_back(quattuor);
     }
 
+    /**
+     * Move planet and moon orbits into one structure-of-arrays store,
+     * planets and moons keep drawing and colliding through their OM view
+     */
+    void setup_orbits() {
+        vector<int> planet_index(planets.size());
+        for (unsigned i = 0; i < planets.size(); ++i) {
+            planet_index[i] = orbits.add(planets[i]->get_degree(), planets[i]->get_position());
+            const vector<moon*> &moons = planets[i]->get_moons();
+            for (unsigned j = 0; j < moons.size(); ++j) {
+                orbits.add(moons[j]->get_degree(), moons[j]->get_position(), planet_index[i]);
+            }
+        }
+        // add() may move the storage, so bind only once every body is in
+        for (unsigned i = 0; i < planets.size(); ++i) {
+            int index = planet_index[i];
+            planets[i]->attach(&orbits, index);
+            const vector<moon*> &moons = planets[i]->get_moons();
+            for (unsigned j = 0; j < moons.size(); ++j) {
+                moons[j]->attach(&orbits, ++index);
+            }
+        }
+    }
+
+    /**
+     * Planets and moons are as dense as the sun, so their pull
+     * scales with their volume
+     */
+    void add_gravity_body(const object3d *o, const vector3<float> &position) {
+        float ratio = o->get_bounding_sphere_radius() / galaxy_constants::helios::radius;
+        gravity.add(position, GRAVITY * ratio * ratio * ratio, o->get_bounding_sphere_radius());
+    }
+
     void setup_oracles() {
         using namespace galaxy_constants;
         oracles.push_back(new oracle(helion::name, helion::radius, helion::degree, helion::position, colors::fire_brick));
@@ -1452,6 +1693,23 @@ private:
         ship_smart_torpedo = new torpedo();
     }
 
+    /**
+     * Everything that can blow up bursts into the shared pool, torpedoes
+     * fired later get it from whoever fires them
+     */
+    void setup_explosions() {
+        apollo->set_explosions(&explosions);
+        for_each(followers.begin(), followers.end(), [&](spaceship *sp) {
+            sp->set_explosions(&explosions);
+        });
+        for_each(shootable_objects.begin(), shootable_objects.end(), [&](missile_moon *m) {
+            m->set_explosions(&explosions);
+        });
+        unum_smart_torpedo->set_explosions(&explosions);
+        tres_smart_torpedo->set_explosions(&explosions);
+        ship_smart_torpedo->set_explosions(&explosions);
+    }
+
     void setup_spaceship_followers() {
         followers.push_back(
                 new spaceship(
@@ -1528,12 +1786,25 @@ private:
     /* is camera currently on planet? */
     bool on_planet_camera;
 
+    /* frustum of the camera being drawn with, in world space */
+    util::frustum view;
+    /* draws of one frame, run sorted by state through gl */
+    util::render_queue queue;
+    util::gl_state gl;
+    /* copies of the moon, torpedo and ship meshes in one frame */
+    util::instance_renderer instances;
+    /* the ship model every spaceship shares, see generate_models() */
+    util::model_mesh warbird;
+
     /* light source for entire scene */
     light *led;
 
     /* particle engine inside the sun */
     particle_engine *engine;
 
+    /* bursts of everything that blew up, moved on update() */
+    explosion_pool explosions;
+
     /* the sun is located at (0, 0, 0) */
     sun *g2v_star;
 
@@ -1548,6 +1819,16 @@ private:
 
     /* four planets */
     vector<planet*> planets;
+    /* update() runs update_jobs on these threads */
+    util::job_system jobs;
+    util::job_graph update_jobs;
+    /* broadphase over everything update_collidable_objects() tests */
+    util::sweep_and_prune broadphase;
+    vector<collider> colliders;
+    /* orbits of the planets and their moons */
+    util::orbit_store orbits;
+    /* Barnes-Hut tree over every attracting body, rebuilt each step */
+    util::gravity_field gravity;
 
     int planet_index;
 
@@ -1568,6 +1849,8 @@ private:
 
     /* space texture index for toggling */
     vector<unsigned> space_textures;
+    /* drawn with the faces of space_textures[st_idx] */
+    util::skybox sky;
     int st_idx;
 
     unsigned planet_texture_id;
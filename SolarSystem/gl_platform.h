@@ -0,0 +1,27 @@
+#ifndef __SOLAR_SYSTEM_GL_PLATFORM_H
+#define __SOLAR_SYSTEM_GL_PLATFORM_H
+
+/**
+ * Single place to pull in OpenGL/GLU/GLUT.
+ *		- SOLAR_SYSTEM_HEADLESS builds against no-op stubs, no window or context
+ *		- OS X uses the GLUT and OpenGL frameworks
+ *		- everything else uses the usual GL/ include path, with the
+ *		  prototypes past GL 1.1 (buffer objects, instancing) declared
+ */
+#if defined(SOLAR_SYSTEM_HEADLESS)
+#include "headless_gl.h"
+#elif defined(__APPLE__)
+#include <GLUT/glut.h>
+#include <OpenGL/gl.h>
+#include <OpenGL/glu.h>
+#include <OpenGL/glext.h>
+#else
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES 1
+#endif
+#include <GL/glut.h>
+#include <GL/gl.h>
+#include <GL/glu.h>
+#endif
+
+#endif
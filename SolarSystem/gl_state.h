@@ -0,0 +1,109 @@
+#ifndef __SOLAR_SYSTEM_GL_STATE_H
+#define __SOLAR_SYSTEM_GL_STATE_H
+
+#include <cstddef>
+
+#include "gl_platform.h"
+
+namespace util {
+	/**
+	 * The GL state a render item needs: the texture bound for
+	 * GL_TEXTURE_2D (0 for none) and whether it is lit. Items in
+	 * a later layer are drawn after all earlier ones.
+	 */
+	struct render_state {
+		GLuint texture;
+		bool lighting;
+		int layer;
+
+		render_state(GLuint texture = 0, bool lighting = true, int layer = 0):
+			texture(texture),
+			lighting(lighting),
+			layer(layer) {
+		}
+	};
+
+	/**
+	 * Remembers the texture and the lighting switch last sent to GL
+	 * and drops calls that would not change them. Anything that goes
+	 * to GL around it has to be followed by invalidate().
+	 */
+	class gl_state {
+	public:
+		gl_state():
+			issued(0),
+			skipped(0) {
+			invalidate();
+		}
+
+		/**
+		 * Forget what GL is in, the next call of each kind goes through
+		 */
+		void invalidate() {
+			texturing = UNKNOWN;
+			lighting = UNKNOWN;
+			texture_known = false;
+			texture = 0;
+		}
+
+		void apply(const render_state &s) {
+			if (s.texture != 0) {
+				set(GL_TEXTURE_2D, true, texturing);
+				bind_texture(s.texture);
+			} else {
+				set(GL_TEXTURE_2D, false, texturing);
+			}
+			set(GL_LIGHTING, s.lighting, lighting);
+		}
+
+		void bind_texture(GLuint id) {
+			if (texture_known && texture == id) {
+				++skipped;
+				return;
+			}
+			glBindTexture(GL_TEXTURE_2D, id);
+			texture = id;
+			texture_known = true;
+			++issued;
+		}
+
+		/**
+		 * State changes sent to GL and dropped as no-ops so far
+		 */
+		size_t get_issued() const {
+			return issued;
+		}
+
+		size_t get_skipped() const {
+			return skipped;
+		}
+
+	private:
+		enum switch_state { UNKNOWN, OFF, ON };
+
+		void set(GLenum cap, bool on, switch_state &current) {
+			const switch_state wanted = on ? ON : OFF;
+			if (current == wanted) {
+				++skipped;
+				return;
+			}
+			if (on) {
+				glEnable(cap);
+			} else {
+				glDisable(cap);
+			}
+			current = wanted;
+			++issued;
+		}
+
+	private:
+		switch_state texturing;
+		switch_state lighting;
+		bool texture_known;
+		GLuint texture;
+		size_t issued;
+		size_t skipped;
+	};
+}
+
+#endif
@@ -0,0 +1,290 @@
+#ifndef __SOLAR_SYSTEM_GRAVITY_FIELD_H
+#define __SOLAR_SYSTEM_GRAVITY_FIELD_H
+
+#include <vector>
+#include <utility>
+#include <cmath>
+#include <cfloat>
+
+#include "vector3.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Barnes-Hut gravity solver.
+	 *
+	 * Bodies are point masses added with add() and indexed by an octree in
+	 * build(). acceleration_at() walks the tree and replaces every cell that
+	 * looks small enough from the query point (cell size / distance < theta)
+	 * by its centre of mass, so a query costs O(log n) instead of O(n).
+	 * theta = 0 gives the exact O(n) sum.
+	 *
+	 * Masses already include the gravitational constant, a body pulls with
+	 * mass / d^2. Inside a body's radius its pull is ignored, which also
+	 * keeps a body from attracting itself.
+	 */
+	class gravity_field {
+	public:
+		static const int LEAF_SIZE = 8;
+		static const int MAX_DEPTH = 24;
+
+	public:
+		gravity_field(float theta = 0.5f):
+			theta(theta) {
+		}
+
+		void set_theta(float value) {
+			theta = (value < 0.0f) ? 0.0f : value;
+		}
+
+		float get_theta() const {
+			return theta;
+		}
+
+		void reserve(size_t n) {
+			x.reserve(n);
+			y.reserve(n);
+			z.reserve(n);
+			mass.reserve(n);
+			radius.reserve(n);
+		}
+
+		/**
+		 * Remove all bodies, keeps the allocated memory
+		 */
+		void clear() {
+			x.clear();
+			y.clear();
+			z.clear();
+			mass.clear();
+			radius.clear();
+			nodes.clear();
+		}
+
+		void add(const vector3<float> &position, float m, float r = 0.0f) {
+			x.push_back(position.get_x());
+			y.push_back(position.get_y());
+			z.push_back(position.get_z());
+			mass.push_back(m);
+			radius.push_back(r);
+		}
+
+		size_t size() const {
+			return x.size();
+		}
+
+		/**
+		 * Build the octree over the bodies added since clear(). Bodies are
+		 * reordered so every cell owns a contiguous range of them.
+		 */
+		void build() {
+			nodes.clear();
+			const size_t n = size();
+			if (n == 0) {
+				return;
+			}
+
+			float lo[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+			float hi[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+			for (size_t i = 0; i < n; ++i) {
+				lo[0] = fminf(lo[0], x[i]), hi[0] = fmaxf(hi[0], x[i]);
+				lo[1] = fminf(lo[1], y[i]), hi[1] = fmaxf(hi[1], y[i]);
+				lo[2] = fminf(lo[2], z[i]), hi[2] = fmaxf(hi[2], z[i]);
+			}
+			float half = 0.5f * fmaxf(hi[0] - lo[0], fmaxf(hi[1] - lo[1], hi[2] - lo[2]));
+			half = half * 1.001f + 1.0f;
+
+			order.resize(n);
+			for (size_t i = 0; i < n; ++i) {
+				order[i] = static_cast<int>(i);
+			}
+			scratch.resize(n);
+
+			nodes.reserve(2 * n / LEAF_SIZE + 1);
+			nodes.push_back(node());
+			nodes[0].cx = 0.5f * (lo[0] + hi[0]);
+			nodes[0].cy = 0.5f * (lo[1] + hi[1]);
+			nodes[0].cz = 0.5f * (lo[2] + hi[2]);
+			nodes[0].half = half;
+			subdivide(0, 0, static_cast<int>(n), 0);
+
+			gather(x);
+			gather(y);
+			gather(z);
+			gather(mass);
+			gather(radius);
+		}
+
+		/**
+		 * Pull of every body on a point, as an acceleration vector
+		 */
+		vector3<float> acceleration_at(const vector3<float> &p) const {
+			float ax = 0.0f, ay = 0.0f, az = 0.0f;
+			if (nodes.empty()) {
+				return vector3<float>(ax, ay, az);
+			}
+			const float px = p.get_x(), py = p.get_y(), pz = p.get_z();
+			const float theta2 = theta * theta;
+
+			int stack[8 * MAX_DEPTH + 8];
+			int top = 0;
+			stack[top++] = 0;
+			while (top > 0) {
+				const node &c = nodes[stack[--top]];
+				if (c.first_child < 0) {
+					for (int i = c.begin; i < c.end; ++i) {
+						pull(px, py, pz, x[i], y[i], z[i], mass[i], radius[i], ax, ay, az);
+					}
+					continue;
+				}
+				const float dx = c.mx - px, dy = c.my - py, dz = c.mz - pz;
+				const float d2 = dx * dx + dy * dy + dz * dz;
+				const float size = 2.0f * c.half;
+				if (!c.contains(px, py, pz) && size * size < theta2 * d2) {
+					pull(px, py, pz, c.mx, c.my, c.mz, c.mass, 0.0f, ax, ay, az);
+					continue;
+				}
+				for (int k = 0; k < 8; ++k) {
+					if (nodes[c.first_child + k].begin < nodes[c.first_child + k].end) {
+						stack[top++] = c.first_child + k;
+					}
+				}
+			}
+			return vector3<float>(ax, ay, az);
+		}
+
+		/**
+		 * Same as acceleration_at() plus its magnitude
+		 */
+		pair<vector3<float>, float> field_at(const vector3<float> &p) const {
+			vector3<float> a = acceleration_at(p);
+			return pair<vector3<float>, float>(a, a.length());
+		}
+
+	private:
+		struct node {
+			float cx, cy, cz, half;		// bounding cube
+			float mx, my, mz, mass;		// centre of mass and total mass
+			int first_child;			// 8 consecutive children, -1 for a leaf
+			int begin, end;				// range of bodies in this cell
+
+			node():
+				cx(0), cy(0), cz(0), half(0),
+				mx(0), my(0), mz(0), mass(0),
+				first_child(-1), begin(0), end(0) {
+			}
+
+			bool contains(float px, float py, float pz) const {
+				return fabsf(px - cx) <= half && fabsf(py - cy) <= half && fabsf(pz - cz) <= half;
+			}
+		};
+
+		static void pull(float px, float py, float pz, float bx, float by, float bz, float m, float r,
+						 float &ax, float &ay, float &az) {
+			const float dx = bx - px, dy = by - py, dz = bz - pz;
+			const float d2 = dx * dx + dy * dy + dz * dz;
+			if (d2 == 0.0f || d2 < r * r) {
+				return;
+			}
+			const float d = sqrtf(d2);
+			const float s = m / (d2 * d);
+			ax += dx * s;
+			ay += dy * s;
+			az += dz * s;
+		}
+
+		int octant(int body, const node &c) const {
+			return (x[body] >= c.cx ? 1 : 0) | (y[body] >= c.cy ? 2 : 0) | (z[body] >= c.cz ? 4 : 0);
+		}
+
+		void subdivide(int index, int begin, int end, int depth) {
+			nodes[index].begin = begin;
+			nodes[index].end = end;
+
+			// centre of mass, bodies are still in their original slots
+			float m = 0.0f, mx = 0.0f, my = 0.0f, mz = 0.0f;
+			for (int i = begin; i < end; ++i) {
+				const int b = order[i];
+				m += mass[b];
+				mx += mass[b] * x[b];
+				my += mass[b] * y[b];
+				mz += mass[b] * z[b];
+			}
+			node &c = nodes[index];
+			c.mass = m;
+			if (m > 0.0f) {
+				c.mx = mx / m, c.my = my / m, c.mz = mz / m;
+			} else {
+				c.mx = c.cx, c.my = c.cy, c.mz = c.cz;
+			}
+
+			if (end - begin <= LEAF_SIZE || depth >= MAX_DEPTH) {
+				return;
+			}
+
+			// counting sort of the range by octant
+			int count[8] = { 0 };
+			for (int i = begin; i < end; ++i) {
+				++count[octant(order[i], c)];
+			}
+			int start[8];
+			start[0] = begin;
+			for (int k = 1; k < 8; ++k) {
+				start[k] = start[k - 1] + count[k - 1];
+			}
+			int fill[8];
+			for (int k = 0; k < 8; ++k) {
+				fill[k] = start[k];
+			}
+			for (int i = begin; i < end; ++i) {
+				scratch[fill[octant(order[i], c)]++] = order[i];
+			}
+			for (int i = begin; i < end; ++i) {
+				order[i] = scratch[i];
+			}
+
+			const float h = 0.5f * c.half;
+			const float cx = c.cx, cy = c.cy, cz = c.cz;
+			const int first = static_cast<int>(nodes.size());
+			nodes[index].first_child = first;
+			for (int k = 0; k < 8; ++k) {
+				node child;
+				child.half = h;
+				child.cx = cx + ((k & 1) ? h : -h);
+				child.cy = cy + ((k & 2) ? h : -h);
+				child.cz = cz + ((k & 4) ? h : -h);
+				nodes.push_back(child);
+			}
+			// nodes may grow below, so only indices are held across calls
+			for (int k = 0; k < 8; ++k) {
+				subdivide(first + k, start[k], start[k] + count[k], depth + 1);
+			}
+		}
+
+		/**
+		 * Put one body array in tree order
+		 */
+		void gather(vector<float> &values) {
+			sorted.resize(values.size());
+			for (size_t i = 0; i < values.size(); ++i) {
+				sorted[i] = values[order[i]];
+			}
+			values.swap(sorted);
+		}
+
+	private:
+		float theta;
+		vector<float> x;
+		vector<float> y;
+		vector<float> z;
+		vector<float> mass;
+		vector<float> radius;
+		vector<node> nodes;
+		vector<int> order;			// body index in tree order
+		vector<int> scratch;
+		vector<float> sorted;
+	};
+}
+
+#endif
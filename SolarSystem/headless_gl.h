@@ -0,0 +1,268 @@
+#ifndef __SOLAR_SYSTEM_HEADLESS_GL_H
+#define __SOLAR_SYSTEM_HEADLESS_GL_H
+
+#include <cstddef>
+
+/**
+ * Stand-in for OpenGL/GLU/GLUT when building with SOLAR_SYSTEM_HEADLESS.
+ * Every entry point the game uses is declared here so the whole scene
+ * compiles and links without a window system or a GL driver.
+ *
+ * All calls are no-ops: the simulation computes its transforms
+ * with util::matrix4 and never reads anything back from GL.
+ */
+
+typedef unsigned int GLenum;
+typedef unsigned char GLboolean;
+typedef unsigned int GLbitfield;
+typedef void GLvoid;
+typedef signed char GLbyte;
+typedef unsigned char GLubyte;
+typedef int GLint;
+typedef unsigned int GLuint;
+typedef int GLsizei;
+typedef float GLfloat;
+typedef double GLdouble;
+typedef ptrdiff_t GLsizeiptr;
+typedef ptrdiff_t GLintptr;
+typedef char GLchar;
+
+struct GLUquadric {
+};
+typedef GLUquadric GLUquadricObj;
+
+#define GL_TRUE                     1
+#define GL_FALSE                    0
+
+#define GL_LINES                    0x0001
+#define GL_TRIANGLES                0x0004
+#define GL_QUADS                    0x0007
+#define GL_ONE                      1
+#define GL_SRC_ALPHA                0x0302
+#define GL_ONE_MINUS_DST_ALPHA      0x0305
+#define GL_FRONT_AND_BACK           0x0408
+#define GL_CCW                      0x0901
+#define GL_CULL_FACE                0x0B44
+#define GL_LIGHTING                 0x0B50
+#define GL_LIGHT_MODEL_AMBIENT      0x0B53
+#define GL_COLOR_MATERIAL           0x0B57
+#define GL_DEPTH_TEST               0x0B71
+#define GL_NORMALIZE                0x0BA1
+#define GL_VIEWPORT                 0x0BA2
+#define GL_MODELVIEW_MATRIX         0x0BA6
+#define GL_PROJECTION_MATRIX        0x0BA7
+#define GL_BLEND                    0x0BE2
+#define GL_TEXTURE_2D               0x0DE1
+#define GL_AMBIENT                  0x1200
+#define GL_DIFFUSE                  0x1201
+#define GL_SPECULAR                 0x1202
+#define GL_POSITION                 0x1203
+#define GL_COMPILE                  0x1300
+#define GL_BYTE                     0x1400
+#define GL_UNSIGNED_BYTE            0x1401
+#define GL_UNSIGNED_SHORT           0x1403
+#define GL_UNSIGNED_INT             0x1405
+#define GL_FLOAT                    0x1406
+#define GL_SHININESS                0x1601
+#define GL_AMBIENT_AND_DIFFUSE      0x1602
+#define GL_MODELVIEW                0x1700
+#define GL_PROJECTION               0x1701
+#define GL_RGB                      0x1907
+#define GL_RGBA                     0x1908
+#define GL_VERSION                  0x1F02
+#define GL_EXTENSIONS               0x1F03
+#define GL_LINEAR                   0x2601
+#define GL_TEXTURE_MAG_FILTER       0x2800
+#define GL_TEXTURE_MIN_FILTER       0x2801
+#define GL_LIGHT0                   0x4000
+#define GL_LIGHT1                   0x4001
+#define GL_LIGHT2                   0x4002
+#define GL_LIGHT3                   0x4003
+#define GL_LIGHT4                   0x4004
+#define GL_LIGHT5                   0x4005
+#define GL_LIGHT6                   0x4006
+#define GL_LIGHT7                   0x4007
+#define GL_VERTEX_ARRAY             0x8074
+#define GL_NORMAL_ARRAY             0x8075
+#define GL_COLOR_ARRAY              0x8076
+#define GL_TEXTURE_COORD_ARRAY      0x8078
+#define GL_ARRAY_BUFFER             0x8892
+#define GL_ELEMENT_ARRAY_BUFFER     0x8893
+#define GL_STREAM_DRAW              0x88E0
+#define GL_STATIC_DRAW              0x88E4
+#define GL_VERTEX_SHADER            0x8B31
+#define GL_COMPILE_STATUS           0x8B81
+#define GL_LINK_STATUS              0x8B82
+#define GL_DEPTH_BUFFER_BIT         0x00000100
+#define GL_COLOR_BUFFER_BIT         0x00004000
+#define GL_ENABLE_BIT               0x00002000
+
+#define GLU_SMOOTH                  100000
+#define GLU_FILL                    100012
+
+#define GLUT_RGB                    0x0000
+#define GLUT_DOUBLE                 0x0002
+#define GLUT_DEPTH                  0x0010
+#define GLUT_ACTIVE_SHIFT           0x0001
+#define GLUT_ACTIVE_CTRL            0x0002
+#define GLUT_RIGHT_BUTTON           0x0002
+#define GLUT_KEY_LEFT               0x0064
+#define GLUT_KEY_UP                 0x0065
+#define GLUT_KEY_RIGHT              0x0066
+#define GLUT_KEY_DOWN               0x0067
+#define GLUT_BITMAP_8_BY_13         ((void *)3)
+#define GLUT_BITMAP_HELVETICA_18    ((void *)8)
+
+/* matrix stack: nothing reads it back any more, see util::matrix4 */
+inline void glMatrixMode(GLenum) {}
+inline void glPushMatrix() {}
+inline void glPopMatrix() {}
+inline void glLoadIdentity() {}
+inline void glLoadMatrixf(const GLfloat *) {}
+inline void glMultMatrixf(const GLfloat *) {}
+inline void glTranslatef(GLfloat, GLfloat, GLfloat) {}
+inline void glScalef(GLfloat, GLfloat, GLfloat) {}
+inline void glRotatef(GLfloat, GLfloat, GLfloat, GLfloat) {}
+
+inline void glGetFloatv(GLenum, GLfloat *params) {
+	for (int i = 0; i < 16; ++i) {
+		params[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+	}
+}
+
+inline void glGetIntegerv(GLenum, GLint *params) {
+	for (int i = 0; i < 4; ++i) {
+		params[i] = 0;
+	}
+}
+
+inline void glOrtho(GLdouble, GLdouble, GLdouble, GLdouble, GLdouble, GLdouble) {}
+inline void gluPerspective(GLdouble, GLdouble, GLdouble, GLdouble) {}
+inline void gluLookAt(GLdouble, GLdouble, GLdouble, GLdouble, GLdouble, GLdouble, GLdouble, GLdouble, GLdouble) {}
+
+/* state */
+inline void glEnable(GLenum) {}
+inline void glDisable(GLenum) {}
+inline void glDepthMask(GLboolean) {}
+inline void glPushAttrib(GLbitfield) {}
+inline void glPopAttrib() {}
+inline void glBlendFunc(GLenum, GLenum) {}
+inline void glFrontFace(GLenum) {}
+inline void glColorMaterial(GLenum, GLenum) {}
+inline void glLineWidth(GLfloat) {}
+inline void glClear(GLbitfield) {}
+inline void glClearColor(GLfloat, GLfloat, GLfloat, GLfloat) {}
+inline void glLightfv(GLenum, GLenum, const GLfloat *) {}
+inline void glLightModelfv(GLenum, const GLfloat *) {}
+inline void glMaterialfv(GLenum, GLenum, const GLfloat *) {}
+
+/* immediate mode */
+inline void glBegin(GLenum) {}
+inline void glEnd() {}
+inline void glVertex3f(GLfloat, GLfloat, GLfloat) {}
+inline void glNormal3f(GLfloat, GLfloat, GLfloat) {}
+inline void glColor3f(GLfloat, GLfloat, GLfloat) {}
+inline void glColor3fv(const GLfloat *) {}
+inline void glColor4fv(const GLfloat *) {}
+inline void glColor4f(GLfloat, GLfloat, GLfloat, GLfloat) {}
+inline void glTexCoord2f(GLfloat, GLfloat) {}
+inline void glRasterPos3f(GLfloat, GLfloat, GLfloat) {}
+inline void glRasterPos3i(GLint, GLint, GLint) {}
+
+/* textures */
+inline void glGenTextures(GLsizei n, GLuint *textures) {
+	for (GLsizei i = 0; i < n; ++i) {
+		textures[i] = 0;
+	}
+}
+inline void glDeleteTextures(GLsizei, const GLuint *) {}
+inline void glBindTexture(GLenum, GLuint) {}
+inline void glTexParameteri(GLenum, GLenum, GLint) {}
+inline void glTexImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const GLvoid *) {}
+
+/* display lists */
+inline void glNewList(GLuint, GLenum) {}
+inline void glEndList() {}
+inline void glCallList(GLuint) {}
+inline void glCallLists(GLsizei, GLenum, const GLvoid *) {}
+inline void glListBase(GLuint) {}
+
+/* vertex arrays and buffer objects */
+inline const GLubyte *glGetString(GLenum) { return NULL; }
+inline void glEnableClientState(GLenum) {}
+inline void glDisableClientState(GLenum) {}
+inline void glVertexPointer(GLint, GLenum, GLsizei, const GLvoid *) {}
+inline void glNormalPointer(GLenum, GLsizei, const GLvoid *) {}
+inline void glColorPointer(GLint, GLenum, GLsizei, const GLvoid *) {}
+inline void glTexCoordPointer(GLint, GLenum, GLsizei, const GLvoid *) {}
+inline void glDrawArrays(GLenum, GLint, GLsizei) {}
+inline void glDrawElements(GLenum, GLsizei, GLenum, const GLvoid *) {}
+inline void glGenBuffers(GLsizei n, GLuint *buffers) {
+	for (GLsizei i = 0; i < n; ++i) {
+		buffers[i] = 0;
+	}
+}
+inline void glDeleteBuffers(GLsizei, const GLuint *) {}
+inline void glBindBuffer(GLenum, GLuint) {}
+inline void glBufferData(GLenum, GLsizeiptr, const GLvoid *, GLenum) {}
+
+/* shaders and instancing, never reached: glGetString() reports no GL */
+inline GLuint glCreateShader(GLenum) { return 0; }
+inline void glShaderSource(GLuint, GLsizei, const GLchar *const *, const GLint *) {}
+inline void glCompileShader(GLuint) {}
+inline void glGetShaderiv(GLuint, GLenum, GLint *params) { *params = GL_FALSE; }
+inline void glDeleteShader(GLuint) {}
+inline GLuint glCreateProgram() { return 0; }
+inline void glAttachShader(GLuint, GLuint) {}
+inline void glBindAttribLocation(GLuint, GLuint, const GLchar *) {}
+inline void glLinkProgram(GLuint) {}
+inline void glGetProgramiv(GLuint, GLenum, GLint *params) { *params = GL_FALSE; }
+inline void glUseProgram(GLuint) {}
+inline void glDeleteProgram(GLuint) {}
+inline void glEnableVertexAttribArray(GLuint) {}
+inline void glDisableVertexAttribArray(GLuint) {}
+inline void glVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const GLvoid *) {}
+inline void glVertexAttribDivisorARB(GLuint, GLuint) {}
+inline void glDrawElementsInstancedARB(GLenum, GLsizei, GLenum, const GLvoid *, GLsizei) {}
+
+/* glu */
+inline GLUquadricObj *gluNewQuadric() { return NULL; }
+inline void gluQuadricDrawStyle(GLUquadricObj *, GLenum) {}
+inline void gluQuadricTexture(GLUquadricObj *, GLboolean) {}
+inline void gluQuadricNormals(GLUquadricObj *, GLenum) {}
+inline void gluSphere(GLUquadricObj *, GLdouble, GLint, GLint) {}
+
+/* glut primitives */
+inline void glutSolidSphere(GLdouble, GLint, GLint) {}
+inline void glutWireSphere(GLdouble, GLint, GLint) {}
+inline void glutSolidCone(GLdouble, GLdouble, GLint, GLint) {}
+inline void glutWireCone(GLdouble, GLdouble, GLint, GLint) {}
+inline void glutSolidCube(GLdouble) {}
+inline void glutWireCube(GLdouble) {}
+inline void glutSolidTorus(GLdouble, GLdouble, GLint, GLint) {}
+inline void glutWireTorus(GLdouble, GLdouble, GLint, GLint) {}
+inline void glutBitmapCharacter(void *, int) {}
+
+/* glut window system */
+inline void glutInit(int *, char **) {}
+inline void glutInitDisplayMode(unsigned int) {}
+inline void glutInitWindowSize(int, int) {}
+inline int glutCreateWindow(const char *) { return 0; }
+inline int glutCreateSubWindow(int, int, int, int, int) { return 0; }
+inline void glutSetWindow(int) {}
+inline void glutPositionWindow(int, int) {}
+inline void glutReshapeWindow(int, int) {}
+inline void glutPostRedisplay() {}
+inline void glutSwapBuffers() {}
+inline int glutGetModifiers() { return 0; }
+inline void glutDisplayFunc(void (*)()) {}
+inline void glutReshapeFunc(void (*)(int, int)) {}
+inline void glutKeyboardFunc(void (*)(unsigned char, int, int)) {}
+inline void glutSpecialFunc(void (*)(int, int, int)) {}
+inline void glutTimerFunc(unsigned int, void (*)(int), int) {}
+inline int glutCreateMenu(void (*)(int)) { return 0; }
+inline void glutAddMenuEntry(const char *, int) {}
+inline void glutAttachMenu(int) {}
+inline void glutMainLoop() {}
+
+#endif
@@ -9,9 +9,7 @@
 #include <vector>
 #include <iostream>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "auto_array.h"
 
@@ -0,0 +1,303 @@
+#ifndef __SOLAR_SYSTEM_INSTANCE_BATCH_H
+#define __SOLAR_SYSTEM_INSTANCE_BATCH_H
+
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+
+#include "gl_platform.h"
+
+#include "matrix4.h"
+#include "vertex_stream.h"
+#include "screen_lod.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * A mesh instance_renderer can draw many copies of: bind() once,
+	 * then any number of draw_bound() at the current transform, or a
+	 * single draw_bound_instanced() when can_instance() says so.
+	 */
+	class instanced_mesh {
+	public:
+		virtual ~instanced_mesh() {}
+
+		virtual void bind() = 0;
+		virtual void draw_bound() const = 0;
+		virtual bool can_instance() const = 0;
+		virtual void draw_bound_instanced(GLsizei count) const = 0;
+		virtual void unbind() = 0;
+	};
+
+	/**
+	 * True when the context can draw instances with per-instance
+	 * attributes: GLSL, ARB_instanced_arrays and ARB_draw_instanced.
+	 * Needs a current context; asks GL only once.
+	 */
+	inline bool has_instancing() {
+		static int supported = -1;
+		if (supported < 0) {
+			supported = 0;
+			const char *version = reinterpret_cast<const char *>(glGetString(GL_VERSION));
+			const char *extensions = reinterpret_cast<const char *>(glGetString(GL_EXTENSIONS));
+			if (version != NULL && extensions != NULL && strtol(version, NULL, 10) >= 2) {
+				supported = (strstr(extensions, "GL_ARB_instanced_arrays") != NULL &&
+					strstr(extensions, "GL_ARB_draw_instanced") != NULL) ? 1 : 0;
+			}
+		}
+		return supported == 1;
+	}
+
+	/**
+	 * Gathers every copy of a few meshes drawn in a frame, each with
+	 * its model matrix and colour, and draws each mesh in one call.
+	 *
+	 * With instancing, the instances go to GL in one buffer and a
+	 * small vertex program lights them like the fixed pipeline does
+	 * with GL_LIGHT0 and GL_COLOR_MATERIAL, in the instance colour
+	 * times the mesh's own. Without it, each mesh is bound once and
+	 * drawn in a loop of glMultMatrixf() and glColor().
+	 */
+	class instance_renderer {
+	public:
+		/* first generic attribute of the model matrix, clear of the
+		   ones fixed-function arrays alias on some drivers */
+		static const GLuint MODEL_ATTRIBUTE = 9;
+		static const GLuint COLOR_ATTRIBUTE = MODEL_ATTRIBUTE + 4;
+
+	public:
+		instance_renderer():
+			program(0),
+			checked(false),
+			draw_calls(0) {
+		}
+
+		~instance_renderer() {
+			if (program != 0) {
+				glDeleteProgram(program);
+			}
+		}
+
+		/**
+		 * Start a frame under the camera on top of the modelview stack
+		 */
+		void begin() {
+			glGetFloatv(GL_MODELVIEW_MATRIX, view.get());
+			for (size_t b = 0; b < batches.size(); ++b) {
+				batches[b].instances.clear();
+			}
+			draw_calls = 0;
+		}
+
+		/**
+		 * Pixels a sphere of "radius" around the origin of "model" covers
+		 * on screen, see lod::projected_radius()
+		 */
+		float projected_radius(float radius, const matrix4 &model) const {
+			matrix4 mv(view);
+			mv.multiply(model);
+			return lod::projected_radius(radius, mv.get());
+		}
+
+		/**
+		 * Queue a copy of "mesh" at "model" in colour "rgb"
+		 */
+		void add(instanced_mesh &mesh, const matrix4 &model, const float rgb[3]) {
+			vector<instance> &instances = get_batch(mesh).instances;
+			instances.push_back(instance());
+			instance &it = instances.back();
+			model.copy_to(it.model);
+			it.color[0] = rgb[0];
+			it.color[1] = rgb[1];
+			it.color[2] = rgb[2];
+			it.color[3] = 1.0f;
+		}
+
+		/**
+		 * Draw everything added since begin() under the current modelview,
+		 * the camera; lighting and texturing are left to the caller
+		 */
+		void flush() {
+			glPushAttrib(GL_ENABLE_BIT); {
+				// the meshes are unit sized and scaled by the model matrix
+				glEnable(GL_NORMALIZE);
+				for (size_t b = 0; b < batches.size(); ++b) {
+					batch &bt = batches[b];
+					if (bt.instances.empty()) {
+						continue;
+					}
+					bt.mesh->bind();
+					if (bt.mesh->can_instance() && use_program()) {
+						draw_instanced(bt);
+					} else {
+						draw_looped(bt);
+					}
+					bt.mesh->unbind();
+				}
+			} glPopAttrib();
+		}
+
+		/**
+		 * Instances added since begin()
+		 */
+		size_t size() const {
+			size_t n = 0;
+			for (size_t b = 0; b < batches.size(); ++b) {
+				n += batches[b].instances.size();
+			}
+			return n;
+		}
+
+		/**
+		 * Draw calls the last flush() made
+		 */
+		size_t get_draw_calls() const {
+			return draw_calls;
+		}
+
+	private:
+		struct instance {
+			float model[16];
+			float color[4];
+		};
+
+		struct batch {
+			instanced_mesh *mesh;
+			vector<instance> instances;
+		};
+
+		batch &get_batch(instanced_mesh &mesh) {
+			// a handful of meshes, a linear search beats a map
+			for (size_t b = 0; b < batches.size(); ++b) {
+				if (batches[b].mesh == &mesh) {
+					return batches[b];
+				}
+			}
+			batches.push_back(batch());
+			batches.back().mesh = &mesh;
+			return batches.back();
+		}
+
+		void draw_looped(const batch &bt) {
+			for (size_t i = 0; i < bt.instances.size(); ++i) {
+				const instance &it = bt.instances[i];
+				glPushMatrix(); {
+					glMultMatrixf(it.model);
+					glColor4fv(it.color);
+					bt.mesh->draw_bound();
+				} glPopMatrix();
+				++draw_calls;
+			}
+		}
+
+		void draw_instanced(const batch &bt) {
+			const GLsizei n = static_cast<GLsizei>(bt.instances.size());
+			stream.upload(&bt.instances[0], n * sizeof(instance));
+			stream.bind();
+			for (GLuint c = 0; c < 5; ++c) {
+				const GLuint attribute = MODEL_ATTRIBUTE + c;
+				const size_t offset = (c < 4) ? offsetof(instance, model) + c * 4 * sizeof(float) : offsetof(instance, color);
+				glEnableVertexAttribArray(attribute);
+				glVertexAttribPointer(attribute, 4, GL_FLOAT, GL_FALSE, sizeof(instance), stream.data(offset));
+				glVertexAttribDivisorARB(attribute, 1);
+			}
+			stream.unbind();
+			// meshes without colours of their own take the instance's
+			glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+			bt.mesh->draw_bound_instanced(n);
+			++draw_calls;
+			for (GLuint c = 0; c < 5; ++c) {
+				glVertexAttribDivisorARB(MODEL_ATTRIBUTE + c, 0);
+				glDisableVertexAttribArray(MODEL_ATTRIBUTE + c);
+			}
+			glUseProgram(0);
+		}
+
+		/**
+		 * Make the instancing program current, building it the first
+		 * time; false when the context cannot instance
+		 */
+		bool use_program() {
+			if (!checked) {
+				checked = true;
+				if (has_instancing()) {
+					program = build_program();
+				}
+			}
+			if (program == 0) {
+				return false;
+			}
+			glUseProgram(program);
+			return true;
+		}
+
+		static GLuint build_program() {
+			static const char *source =
+				"#version 120\n"
+				"attribute vec4 model0;\n"
+				"attribute vec4 model1;\n"
+				"attribute vec4 model2;\n"
+				"attribute vec4 model3;\n"
+				"attribute vec4 color;\n"
+				"void main() {\n"
+				"    vec4 eye = gl_ModelViewMatrix * (mat4(model0, model1, model2, model3) * gl_Vertex);\n"
+				"    gl_Position = gl_ProjectionMatrix * eye;\n"
+				"    vec3 n = normalize(gl_NormalMatrix * (mat3(model0.xyz, model1.xyz, model2.xyz) * gl_Normal));\n"
+				"    vec4 p = gl_LightSource[0].position;\n"
+				"    vec3 l = normalize(p.w == 0.0 ? p.xyz : p.xyz - eye.xyz);\n"
+				"    float diffuse = max(dot(n, l), 0.0);\n"
+				"    float specular = 0.0;\n"
+				"    if (diffuse > 0.0) {\n"
+				"        specular = pow(max(dot(n, normalize(l + vec3(0.0, 0.0, 1.0))), 0.0), gl_FrontMaterial.shininess);\n"
+				"    }\n"
+				"    vec4 c = color * gl_Color;\n"
+				"    vec4 lit = gl_FrontMaterial.emission\n"
+				"        + c * (gl_LightModel.ambient + gl_LightSource[0].ambient + gl_LightSource[0].diffuse * diffuse)\n"
+				"        + gl_FrontMaterial.specular * gl_LightSource[0].specular * specular;\n"
+				"    gl_FrontColor = vec4(clamp(lit.rgb, 0.0, 1.0), c.a);\n"
+				"}\n";
+			GLint ok = GL_FALSE;
+			const GLuint shader = glCreateShader(GL_VERTEX_SHADER);
+			glShaderSource(shader, 1, &source, NULL);
+			glCompileShader(shader);
+			glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+			if (ok != GL_TRUE) {
+				glDeleteShader(shader);
+				return 0;
+			}
+			const GLuint p = glCreateProgram();
+			glAttachShader(p, shader);
+			glBindAttribLocation(p, MODEL_ATTRIBUTE, "model0");
+			glBindAttribLocation(p, MODEL_ATTRIBUTE + 1, "model1");
+			glBindAttribLocation(p, MODEL_ATTRIBUTE + 2, "model2");
+			glBindAttribLocation(p, MODEL_ATTRIBUTE + 3, "model3");
+			glBindAttribLocation(p, COLOR_ATTRIBUTE, "color");
+			glLinkProgram(p);
+			// the program keeps it alive
+			glDeleteShader(shader);
+			glGetProgramiv(p, GL_LINK_STATUS, &ok);
+			if (ok != GL_TRUE) {
+				glDeleteProgram(p);
+				return 0;
+			}
+			return p;
+		}
+
+	private:
+		// owns a GL program, never copied
+		instance_renderer(const instance_renderer &);
+		instance_renderer &operator =(const instance_renderer &);
+
+	private:
+		matrix4 view;
+		vector<batch> batches;
+		vertex_stream stream;
+		GLuint program;
+		bool checked;
+		size_t draw_calls;
+	};
+}
+
+#endif
@@ -0,0 +1,251 @@
+#ifndef __SOLAR_SYSTEM_JOB_SYSTEM_H
+#define __SOLAR_SYSTEM_JOB_SYSTEM_H
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <initializer_list>
+
+using namespace std;
+
+namespace util {
+	/**
+	 * A set of jobs and the jobs each one has to wait for. Build it once
+	 * and hand it to job_system::run() as often as needed.
+	 */
+	class job_graph {
+	public:
+		typedef function<void()> job;
+
+	public:
+		/**
+		 * Add a job that runs once every job in "after" has finished,
+		 * returns its id. Dependencies must be added first.
+		 */
+		int add(const job &fn, initializer_list<int> after = initializer_list<int>()) {
+			node n;
+			n.fn = fn;
+			n.dependencies = 0;
+			nodes.push_back(n);
+			const int id = static_cast<int>(nodes.size() - 1);
+			for (initializer_list<int>::const_iterator it = after.begin(); it != after.end(); ++it) {
+				nodes[*it].dependents.push_back(id);
+				++nodes[id].dependencies;
+			}
+			return id;
+		}
+
+		size_t size() const {
+			return nodes.size();
+		}
+
+		void clear() {
+			nodes.clear();
+		}
+
+	private:
+		friend class job_system;
+
+		struct node {
+			job fn;
+			vector<int> dependents;
+			int dependencies;
+		};
+
+		vector<node> nodes;
+	};
+
+	/**
+	 * Work-stealing scheduler.
+	 *
+	 * Every worker owns a deque: it pushes the jobs it unlocks to the back
+	 * and pops from the back, so dependent work stays on a warm cache;
+	 * idle workers steal from the front of the others. The thread that
+	 * calls run() works as worker 0 until the whole graph is done, so
+	 * with no extra workers a graph simply runs inline.
+	 */
+	class job_system {
+	public:
+		static unsigned default_workers() {
+			unsigned n = thread::hardware_concurrency();
+			return (n > 1) ? n - 1 : 0;
+		}
+
+	public:
+		explicit job_system(unsigned workers = default_workers()):
+			graph(NULL),
+			pending_size(0),
+			remaining(0),
+			queued(0),
+			stopping(false) {
+			start(workers);
+		}
+
+		~job_system() {
+			stop();
+		}
+
+		/**
+		 * Number of threads besides the caller of run()
+		 */
+		unsigned get_workers() const {
+			return static_cast<unsigned>(threads.size());
+		}
+
+		void set_workers(unsigned workers) {
+			if (workers != get_workers()) {
+				stop();
+				start(workers);
+			}
+		}
+
+		/**
+		 * Run every job of g respecting its dependencies, returns when
+		 * all of them have finished. Not reentrant.
+		 */
+		void run(job_graph &g) {
+			const size_t n = g.size();
+			if (n == 0) {
+				return;
+			}
+			if (pending_size < n) {
+				pending.reset(new atomic<int>[n]);
+				pending_size = n;
+			}
+			for (size_t i = 0; i < n; ++i) {
+				pending[i].store(g.nodes[i].dependencies, memory_order_relaxed);
+			}
+			remaining.store(static_cast<int>(n));
+			graph = &g;
+			for (size_t i = 0; i < n; ++i) {
+				if (g.nodes[i].dependencies == 0) {
+					push(0, static_cast<int>(i));
+				}
+			}
+			while (remaining.load() > 0) {
+				int id;
+				if (pop(0, id) || steal(0, id)) {
+					execute(0, id);
+				} else {
+					this_thread::yield();
+				}
+			}
+			graph = NULL;
+		}
+
+	private:
+		struct job_queue {
+			mutex lock;
+			deque<int> jobs;
+		};
+
+		void start(unsigned workers) {
+			stopping = false;
+			queues.clear();
+			for (unsigned i = 0; i <= workers; ++i) {
+				queues.push_back(unique_ptr<job_queue>(new job_queue()));
+			}
+			for (unsigned i = 1; i <= workers; ++i) {
+				threads.push_back(thread(&job_system::work, this, i));
+			}
+		}
+
+		void stop() {
+			{
+				lock_guard<mutex> guard(sleep_lock);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (size_t i = 0; i < threads.size(); ++i) {
+				threads[i].join();
+			}
+			threads.clear();
+		}
+
+		void work(unsigned index) {
+			for (;;) {
+				int id;
+				if (pop(index, id) || steal(index, id)) {
+					execute(index, id);
+					continue;
+				}
+				unique_lock<mutex> guard(sleep_lock);
+				wake.wait(guard, [this] { return stopping || queued.load() > 0; });
+				if (stopping) {
+					return;
+				}
+			}
+		}
+
+		void execute(unsigned index, int id) {
+			const job_graph::node &n = graph->nodes[id];
+			n.fn();
+			for (size_t i = 0; i < n.dependents.size(); ++i) {
+				const int next = n.dependents[i];
+				if (pending[next].fetch_sub(1) == 1) {
+					push(index, next);
+				}
+			}
+			remaining.fetch_sub(1);
+		}
+
+		void push(unsigned index, int id) {
+			{
+				lock_guard<mutex> guard(queues[index]->lock);
+				queues[index]->jobs.push_back(id);
+			}
+			queued.fetch_add(1);
+			if (!threads.empty()) {
+				// a worker may be between its check and its wait
+				{ lock_guard<mutex> guard(sleep_lock); }
+				wake.notify_one();
+			}
+		}
+
+		bool pop(unsigned index, int &id) {
+			job_queue &q = *queues[index];
+			lock_guard<mutex> guard(q.lock);
+			if (q.jobs.empty()) {
+				return false;
+			}
+			id = q.jobs.back();
+			q.jobs.pop_back();
+			queued.fetch_sub(1);
+			return true;
+		}
+
+		bool steal(unsigned index, int &id) {
+			const size_t n = queues.size();
+			for (size_t k = 1; k < n; ++k) {
+				job_queue &q = *queues[(index + k) % n];
+				lock_guard<mutex> guard(q.lock);
+				if (!q.jobs.empty()) {
+					id = q.jobs.front();
+					q.jobs.pop_front();
+					queued.fetch_sub(1);
+					return true;
+				}
+			}
+			return false;
+		}
+
+	private:
+		job_graph *graph;
+		unique_ptr<atomic<int>[]> pending;		// unfinished dependencies per job
+		size_t pending_size;
+		atomic<int> remaining;					// jobs not finished yet
+		atomic<int> queued;						// jobs waiting in any queue
+		bool stopping;
+		vector<unique_ptr<job_queue> > queues;	// queues[0] belongs to the caller of run()
+		vector<thread> threads;
+		mutex sleep_lock;
+		condition_variable wake;
+	};
+}
+
+#endif
@@ -6,11 +6,10 @@
 
 #include "drawable.h"
 #include "object3d.h"
+#include "matrix4.h"
 #include "colors.h"
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 using namespace std;
 
@@ -131,16 +130,13 @@ public:
     }
 
     void draw() {
-        float cm[16];
+        matrix4 m;
+        m.rotate_x(theta_x);
+        m.rotate_z(theta_z);
+        m.translate(light_position[0], light_position[1], light_position[2]);
+        m.copy_to(OM);
         glPushMatrix(); {
             glColor3fv(get_color(colors::cyan));
-            glGetFloatv(GL_MODELVIEW_MATRIX, cm);
-            glLoadIdentity();
-            glRotatef(theta_x, 1.0, 0.0, 0.0);
-            glRotatef(theta_z, 0.0, 0.0, 1.0);
-            glTranslatef(light_position[0], light_position[1], light_position[2]);
-            glGetFloatv(GL_MODELVIEW_MATRIX, OM);
-            glLoadMatrixf(cm);
             glMultMatrixf(OM);
             turn_on();
             glutWireCube(500);
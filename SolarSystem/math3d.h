@@ -2,7 +2,9 @@
 #define __SOLAR_SYSTEM_MATH_3D_H
 
 #include <cmath>
+#include <cstddef>
 #include "vector3.h"
+#include "matrix4.h"
 
 namespace util {
 	namespace constants {
@@ -47,6 +49,90 @@ namespace util {
 			float c = cos(radians);
 			return (v * c) + axis * axis.dot(v) * (1 - c) + v.cross(axis) * s;
 		}
+
+		/**
+		 * Rotate v by the upper 3x3 of a precomputed matrix, e.g. one built
+		 * once with matrix4::rotate() instead of calling sin/cos per vector
+		 */
+		inline vector3<float> rotate(const matrix4 &r, const vector3<float> &v) {
+			const float *m = r.get();
+			simd::float4 out = simd::mul(simd::set(m[0], m[1], m[2], 0.0f), simd::splat(v.get_x()));
+			out = simd::add(out, simd::mul(simd::set(m[4], m[5], m[6], 0.0f), simd::splat(v.get_y())));
+			out = simd::add(out, simd::mul(simd::set(m[8], m[9], m[10], 0.0f), simd::splat(v.get_z())));
+			return vector3<float>(out);
+		}
+
+		/**
+		 * Batch rotate, in and out may be the same array
+		 */
+		inline void rotate(const matrix4 &r, const vector3<float> *in, vector3<float> *out, size_t n) {
+			const float *m = r.get();
+			const simd::float4 c0 = simd::set(m[0], m[1], m[2], 0.0f);
+			const simd::float4 c1 = simd::set(m[4], m[5], m[6], 0.0f);
+			const simd::float4 c2 = simd::set(m[8], m[9], m[10], 0.0f);
+			for (size_t i = 0; i < n; ++i) {
+				const vector3<float> &v = in[i];
+				simd::float4 p = simd::mul(c0, simd::splat(v.get_x()));
+				p = simd::add(p, simd::mul(c1, simd::splat(v.get_y())));
+				p = simd::add(p, simd::mul(c2, simd::splat(v.get_z())));
+				out[i] = vector3<float>(p);
+			}
+		}
+
+		/**
+		 * Batch squared distance from every point to "to", no square roots
+		 */
+		inline void distance_squared(const vector3<float> *points, size_t n, const vector3<float> &to, float *out) {
+			for (size_t i = 0; i < n; ++i) {
+				const vector3<float> d(points[i] - to);
+				out[i] = d.dot(d);
+			}
+		}
+
+		/**
+		 * Batch normalize in place, zero vectors stay zero
+		 */
+		inline void normalize(vector3<float> *v, size_t n) {
+			for (size_t i = 0; i < n; ++i) {
+				v[i].normalize();
+			}
+		}
+
+		/**
+		 * Swept sphere test: sphere a moves from a0 to a1 and sphere b from
+		 * b0 to b1 over the same step. Returns true if they touch during the
+		 * step, with the earliest time of impact in [0, 1] in toi
+		 * (0 = start of the step, 1 = end).
+		 */
+		template <typename T>
+		bool sweep_spheres(const vector3<T> &a0, const vector3<T> &a1, T ra,
+						   const vector3<T> &b0, const vector3<T> &b1, T rb, T &toi) {
+			// move in a's frame: b starts at d and travels v
+			const vector3<T> d(b0 - a0);
+			const vector3<T> v((b1 - b0) - (a1 - a0));
+			const T r = ra + rb;
+			const T c = d.dot(d) - r * r;
+			if (c <= 0) {
+				toi = 0;
+				return true;
+			}
+			const T a = v.dot(v);
+			const T b = d.dot(v);
+			if (a == 0 || b >= 0) {
+				// not moving relative to each other, or moving apart
+				return false;
+			}
+			const T disc = b * b - a * c;
+			if (disc < 0) {
+				return false;
+			}
+			const T t = (-b - sqrt(disc)) / a;
+			if (t > 1) {
+				return false;
+			}
+			toi = t;
+			return true;
+		}
 	}
 }
 
@@ -0,0 +1,172 @@
+#ifndef __SOLAR_SYSTEM_MATRIX4_H
+#define __SOLAR_SYSTEM_MATRIX4_H
+
+#include <cmath>
+#include <cstring>
+
+namespace util {
+	/**
+	 * 4x4 float matrix stored column-major, the same layout
+	 * glGetFloatv(GL_MODELVIEW_MATRIX, ...) returns, so it can be
+	 * copied straight into object3d::OM or passed to glMultMatrixf().
+	 *
+	 * translate/rotate/scale post-multiply like their GL counterparts,
+	 * so a sequence of calls reads exactly like the old GL code.
+	 */
+	class matrix4 {
+	public:
+		matrix4() {
+			load_identity();
+		}
+
+		explicit matrix4(const float data[16]) {
+			memcpy(m, data, sizeof(m));
+		}
+
+		void load_identity() {
+			for (int i = 0; i < 16; ++i) {
+				m[i] = 0.0f;
+			}
+			m[0] = m[5] = m[10] = m[15] = 1.0f;
+		}
+
+		const float *get() const {
+			return m;
+		}
+
+		float *get() {
+			return m;
+		}
+
+		void copy_to(float out[16]) const {
+			memcpy(out, m, sizeof(m));
+		}
+
+		float operator [](int i) const {
+			return m[i];
+		}
+
+		/**
+		 * this = this * rhs
+		 */
+		void multiply(const float rhs[16]) {
+			float r[16];
+			for (int c = 0; c < 4; ++c) {
+				const float b0 = rhs[c * 4 + 0];
+				const float b1 = rhs[c * 4 + 1];
+				const float b2 = rhs[c * 4 + 2];
+				const float b3 = rhs[c * 4 + 3];
+				for (int row = 0; row < 4; ++row) {
+					r[c * 4 + row] = m[row] * b0 + m[4 + row] * b1 + m[8 + row] * b2 + m[12 + row] * b3;
+				}
+			}
+			memcpy(m, r, sizeof(m));
+		}
+
+		void multiply(const matrix4 &rhs) {
+			multiply(rhs.m);
+		}
+
+		/**
+		 * Same as glTranslatef: only the translation column changes
+		 */
+		void translate(float x, float y, float z) {
+			m[12] += m[0] * x + m[4] * y + m[8] * z;
+			m[13] += m[1] * x + m[5] * y + m[9] * z;
+			m[14] += m[2] * x + m[6] * y + m[10] * z;
+			m[15] += m[3] * x + m[7] * y + m[11] * z;
+		}
+
+		void scale(float x, float y, float z) {
+			for (int i = 0; i < 4; ++i) {
+				m[i] *= x;
+				m[4 + i] *= y;
+				m[8 + i] *= z;
+			}
+		}
+
+		/**
+		 * Same as glRotatef(degrees, 1, 0, 0), touches columns 1 and 2 only
+		 */
+		void rotate_x(float degrees) {
+			if (degrees == 0.0f) {
+				return;
+			}
+			float s, c;
+			sin_cos(degrees, s, c);
+			for (int i = 0; i < 4; ++i) {
+				const float u = m[4 + i];
+				const float a = m[8 + i];
+				m[4 + i] = u * c + a * s;
+				m[8 + i] = a * c - u * s;
+			}
+		}
+
+		/**
+		 * Same as glRotatef(degrees, 0, 1, 0), touches columns 0 and 2 only
+		 */
+		void rotate_y(float degrees) {
+			if (degrees == 0.0f) {
+				return;
+			}
+			float s, c;
+			sin_cos(degrees, s, c);
+			for (int i = 0; i < 4; ++i) {
+				const float r = m[i];
+				const float a = m[8 + i];
+				m[i] = r * c - a * s;
+				m[8 + i] = r * s + a * c;
+			}
+		}
+
+		/**
+		 * Same as glRotatef(degrees, 0, 0, 1), touches columns 0 and 1 only
+		 */
+		void rotate_z(float degrees) {
+			if (degrees == 0.0f) {
+				return;
+			}
+			float s, c;
+			sin_cos(degrees, s, c);
+			for (int i = 0; i < 4; ++i) {
+				const float r = m[i];
+				const float u = m[4 + i];
+				m[i] = r * c + u * s;
+				m[4 + i] = u * c - r * s;
+			}
+		}
+
+		/**
+		 * Same as glRotatef(degrees, x, y, z) for an arbitrary axis
+		 */
+		void rotate(float degrees, float x, float y, float z) {
+			float length = sqrtf(x * x + y * y + z * z);
+			if (degrees == 0.0f || length == 0.0f) {
+				return;
+			}
+			x /= length, y /= length, z /= length;
+			float s, c;
+			sin_cos(degrees, s, c);
+			const float t = 1.0f - c;
+			const float r[16] = {
+				x * x * t + c,      y * x * t + z * s,  x * z * t - y * s,  0.0f,
+				x * y * t - z * s,  y * y * t + c,      y * z * t + x * s,  0.0f,
+				x * z * t + y * s,  y * z * t - x * s,  z * z * t + c,      0.0f,
+				0.0f,               0.0f,               0.0f,               1.0f
+			};
+			multiply(r);
+		}
+
+	private:
+		static void sin_cos(float degrees, float &s, float &c) {
+			const float radians = degrees * 3.1415926535f / 180.0f;
+			s = sinf(radians);
+			c = cosf(radians);
+		}
+
+	private:
+		float m[16];
+	};
+}
+
+#endif
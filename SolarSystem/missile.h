@@ -10,9 +10,7 @@
 #include <deque>
 #include <random>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "drawable.h"
 #include "movable.h"
@@ -81,7 +79,7 @@ public:
 	void draw() {
 		glPushMatrix(); {
 			// update
-			glMultMatrixf(OM);
+			glMultMatrixf(RM);
 			// actual rendering
 			draw_itself(mtype);
 			// draw axis or bounding sphere
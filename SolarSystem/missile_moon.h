@@ -11,14 +11,17 @@
 #include "math3d.h"
 #include "object3d.h"
 #include "torpedo.h"
+#include "explodable.h"
 
 using namespace std;
 using namespace colors;
 
-class missile_moon: public moon, public shootable {
+class missile_moon: public moon, public shootable, public explodable {
 
 private:
     static const int TOTAL_MISSILES = 10;
+    /* reach of the burst when the moon is shot down */
+    static constexpr float EXPLOSION_RADIUS = 500.0f;
 
 public:
     missile_moon(const string &name = "missile_moon", float radius = 1.0f, float degree = 1.0f, float pos[3] = NULL, const color_name &c = red, const int distance = 5000):
@@ -26,8 +29,7 @@ public:
     count(TOTAL_MISSILES),
     torpe(NULL),
     detection_distance(distance),
-    alive(true),
-    explosion_radius(500) {
+    alive(true) {
     }
 
     ~missile_moon() {
@@ -41,28 +43,31 @@ public:
         return false;
     }
 
-    void draw_explosion() {
-        if (explosion_radius > 0) {
-            glColor3fv(get_color(colors::red));
-            glutWireSphere(explosion_radius, 30, 17);
-            explosion_radius -= 50;
-        }
-    }
-
     void draw() {
         glPushMatrix(); {
             // update itself
-            glMultMatrixf(OM);
+            glMultMatrixf(RM);
             if (alive) {
                 moon::draw_itself();
-            } else {
-                draw_explosion();
             }
             // draw axes or bounding sphere
             object3d::draw();
         } glPopMatrix();
     }
 
+    /**
+     * A shot down moon leaves nothing to queue, only its overlays
+     */
+    bool submit(util::instance_renderer &instances, const util::matrix4 &parent) {
+        if (has_overlays() || (alive && !is_solid())) {
+            return false;
+        }
+        if (alive) {
+            submit_sphere(instances, parent);
+        }
+        return true;
+    }
+
     /**
      * Shoot target and return a smart torpedo
      * for galaxy
@@ -76,6 +81,7 @@ public:
             initial_target[1] += 5000;
             if (torpe == NULL) {
                 torpe = new torpedo("torpedo", start, initial_target, colors::red, torpedo_type::AIM_4_FALCON, 10, 1000);
+                torpe->set_explosions(get_explosions());
                 return torpe;
             } else {
                 torpe->set_new_position(start);
@@ -100,6 +106,9 @@ public:
     }
 
     void destroy() {
+        if (alive) {
+            explode(get_world_position(), EXPLOSION_RADIUS, colors::red);
+        }
         alive = false;
     }
 
@@ -108,7 +117,6 @@ private:
     int count;
     const double detection_distance;
     torpedo *torpe;
-    int explosion_radius;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,196 @@
+#ifndef __SOLAR_SYSTEM_MODEL_MESH_H
+#define __SOLAR_SYSTEM_MODEL_MESH_H
+
+#include <vector>
+#include <map>
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+#include <stdint.h>
+
+#include "gl_platform.h"
+
+#include "vertex_stream.h"
+#include "instance_batch.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * One corner of a model: position, normal and colour, interleaved
+	 * the way it is read from a file and handed to GL
+	 */
+	struct model_vertex {
+		float x, y, z;
+		float nx, ny, nz;
+		unsigned char r, g, b, a;
+	};
+
+	/**
+	 * A triangle model with shared vertices, read from a small binary
+	 * file and drawn from static vertex and index buffers (client arrays
+	 * without them). Triangles are added one at a time by the tool that
+	 * writes the file; corners with the same position, normal and
+	 * colour become one vertex.
+	 *
+	 * File layout, little endian: "MSH1", the vertex and index counts
+	 * as uint32, the model_vertex array, then uint16 indices.
+	 */
+	class model_mesh : public instanced_mesh {
+	public:
+		/**
+		 * Add a triangle with one normal and one colour for all three
+		 * corners, reusing vertices seen before
+		 */
+		void add_triangle(const float v[3][3], const float n[3], const unsigned char rgb[3]) {
+			for (int i = 0; i < 3; ++i) {
+				model_vertex mv;
+				memset(&mv, 0, sizeof(mv));
+				mv.x = v[i][0], mv.y = v[i][1], mv.z = v[i][2];
+				mv.nx = n[0], mv.ny = n[1], mv.nz = n[2];
+				mv.r = rgb[0], mv.g = rgb[1], mv.b = rgb[2], mv.a = 255;
+				const vertex_key key(mv);
+				map<vertex_key, uint16_t>::iterator it = welded.find(key);
+				if (it == welded.end()) {
+					it = welded.insert(make_pair(key, static_cast<uint16_t>(vertices.size()))).first;
+					vertices.push_back(mv);
+				}
+				indices.push_back(it->second);
+			}
+		}
+
+		/**
+		 * Read "filename", scaling the positions by "scale". False and
+		 * an empty mesh when the file is missing or not a mesh.
+		 */
+		bool load(const char *filename, float scale = 1.0f) {
+			clear();
+			FILE *in = fopen(filename, "rb");
+			if (in == NULL) {
+				return false;
+			}
+			char magic[4];
+			uint32_t counts[2];
+			bool ok = fread(magic, 1, 4, in) == 4 && memcmp(magic, "MSH1", 4) == 0 &&
+				fread(counts, sizeof(uint32_t), 2, in) == 2 && counts[0] <= 65536 && counts[1] % 3 == 0;
+			if (ok) {
+				vertices.resize(counts[0]);
+				indices.resize(counts[1]);
+				ok = fread(&vertices[0], sizeof(model_vertex), counts[0], in) == counts[0] &&
+					fread(&indices[0], sizeof(uint16_t), counts[1], in) == counts[1];
+			}
+			fclose(in);
+			for (size_t i = 0; ok && i < indices.size(); ++i) {
+				ok = indices[i] < vertices.size();
+			}
+			if (!ok) {
+				clear();
+				return false;
+			}
+			for (size_t i = 0; i < vertices.size(); ++i) {
+				vertices[i].x *= scale;
+				vertices[i].y *= scale;
+				vertices[i].z *= scale;
+			}
+			return true;
+		}
+
+		bool save(const char *filename) const {
+			FILE *out = fopen(filename, "wb");
+			if (out == NULL) {
+				return false;
+			}
+			const uint32_t counts[2] = { static_cast<uint32_t>(vertices.size()), static_cast<uint32_t>(indices.size()) };
+			bool ok = fwrite("MSH1", 1, 4, out) == 4 &&
+				fwrite(counts, sizeof(uint32_t), 2, out) == 2 &&
+				fwrite(&vertices[0], sizeof(model_vertex), vertices.size(), out) == vertices.size() &&
+				fwrite(&indices[0], sizeof(uint16_t), indices.size(), out) == indices.size();
+			return fclose(out) == 0 && ok;
+		}
+
+		void clear() {
+			vertices.clear();
+			indices.clear();
+			welded.clear();
+		}
+
+		bool empty() const {
+			return indices.empty();
+		}
+
+		/**
+		 * Draw the model at the current transform
+		 */
+		void draw() {
+			if (empty()) {
+				return;
+			}
+			bind();
+			draw_bound();
+			unbind();
+		}
+
+		void bind() {
+			buffers.bind(&vertices[0], vertices.size() * sizeof(model_vertex), &indices[0], indices.size() * sizeof(uint16_t));
+			const GLsizei bytes = static_cast<GLsizei>(sizeof(model_vertex));
+			glEnableClientState(GL_VERTEX_ARRAY);
+			glEnableClientState(GL_NORMAL_ARRAY);
+			glEnableClientState(GL_COLOR_ARRAY);
+			glVertexPointer(3, GL_FLOAT, bytes, buffers.vertex_data(offsetof(model_vertex, x)));
+			glNormalPointer(GL_FLOAT, bytes, buffers.vertex_data(offsetof(model_vertex, nx)));
+			glColorPointer(4, GL_UNSIGNED_BYTE, bytes, buffers.vertex_data(offsetof(model_vertex, r)));
+		}
+
+		void draw_bound() const {
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_SHORT, buffers.index_data());
+		}
+
+		bool can_instance() const {
+			return true;
+		}
+
+		void draw_bound_instanced(GLsizei count) const {
+			glDrawElementsInstancedARB(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_SHORT, buffers.index_data(), count);
+		}
+
+		void unbind() {
+			glDisableClientState(GL_COLOR_ARRAY);
+			glDisableClientState(GL_NORMAL_ARRAY);
+			glDisableClientState(GL_VERTEX_ARRAY);
+			buffers.unbind();
+		}
+
+		size_t get_vertex_count() const {
+			return vertices.size();
+		}
+
+		size_t get_triangle_count() const {
+			return indices.size() / 3;
+		}
+
+	private:
+		/**
+		 * Orders vertices by their bytes, for welding exact duplicates
+		 */
+		struct vertex_key {
+			model_vertex v;
+
+			explicit vertex_key(const model_vertex &v):
+				v(v) {
+			}
+
+			bool operator <(const vertex_key &o) const {
+				return memcmp(&v, &o.v, sizeof(model_vertex)) < 0;
+			}
+		};
+
+	private:
+		vector<model_vertex> vertices;
+		vector<uint16_t> indices;
+		// vertex of each distinct corner while triangles are added
+		map<vertex_key, uint16_t> welded;
+		static_buffers buffers;
+	};
+}
+
+#endif
@@ -2,9 +2,7 @@
 #define __SOLAR_SYSTEM_MOON_H
 
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include <iostream>
 #include <cstdlib>
@@ -15,6 +13,9 @@
 #include "drawable.h"
 #include "missile.h"
 #include "spaceship.h"
+#include "orbit_store.h"
+#include "sphere_mesh.h"
+#include "screen_lod.h"
 
 using namespace colors;
 
@@ -23,6 +24,19 @@ class moon:
 	public movable,
 	public drawable {
 
+public:
+	/* sphere tessellations from up close to a few pixels wide */
+	static const int LOD_COUNT = 3;
+
+	static const util::lod_level *get_lod_levels() {
+		static const util::lod_level levels[LOD_COUNT] = {
+			{ 40, 20, 40.0f },
+			{ 20, 10, 10.0f },
+			{ 10, 6, 0.0f }
+		};
+		return levels;
+	}
+
 public:
 	virtual ~moon() {
 	}
@@ -33,7 +47,9 @@ public:
          float p[3] = NULL,
          const color_name &c = red)
 		:object3d(name, radius, false, vector3<float>(p[0], p[1], p[2]), vector3<float>(0, 1, 0)), 
-		radius(radius), degree(degree), color(c), angle(0.0f) {
+		radius(radius), degree(degree), color(c), angle(0.0f),
+		orbits(NULL), orbit_index(-1),
+		lod(get_lod_levels(), LOD_COUNT) {
 		collidable = true;
 		rotate_about = true;
 		bounding_sphere_radius = radius + 10;
@@ -43,7 +59,7 @@ public:
 	virtual void draw() {
 		glPushMatrix(); {
 			// update itself
-			glMultMatrixf(OM);
+			glMultMatrixf(RM);
 			// actual rendering
 			draw_itself();
 			// draw axes or bounding sphere
@@ -54,13 +70,33 @@ public:
 	void draw_itself() {
 		glColor3fv(get_color(color));
 		if (is_solid()) {
-			glutSolidSphere(radius, 40, 20);
+			const util::lod_level &level = lod.select_for_radius(radius);
+			util::sphere_cache::get(level.slices, level.stacks, false).draw(radius);
 		} else {
-			glutWireSphere(radius, 40, 20);
+			const util::lod_level &level = lod.select_for_radius(radius);
+			glutWireSphere(radius, level.slices, level.stacks);
+		}
+	}
+
+	/**
+	 * Queue the moon as a copy of a cached sphere, "parent" being the
+	 * planet's drawing frame. False when draw() has to be called
+	 * instead, for wire frames and overlays.
+	 */
+	virtual bool submit(util::instance_renderer &instances, const util::matrix4 &parent) {
+		if (!is_solid() || has_overlays()) {
+			return false;
 		}
+		submit_sphere(instances, parent);
+		return true;
 	}
 
 	virtual void update() {
+		if (orbits != NULL) {
+			// OM was already advanced by orbit_store::update()
+			yaw = orbits->get_angle(orbit_index);
+			return;
+		}
 		yaw += degree;
 		if (yaw >= 360.f) {
 			yaw = 0.0f;
@@ -68,6 +104,20 @@ public:
 		object3d::update_internal();
 	}
 
+	/**
+	 * Hand the orbit over to a batched store, OM becomes a view of
+	 * the store's local transform for this moon
+	 */
+	void attach(util::orbit_store *store, int index) {
+		orbits = store;
+		orbit_index = index;
+		bind_orientation(store->get_local(index));
+	}
+
+	float get_degree() const {
+		return degree;
+	}
+
 	void set_parent_position(const vector3<float> &pos) {
 		parent_position = pos;
 	}
@@ -76,6 +126,30 @@ public:
 		return parent_position;
 	}
 
+	/**
+	 * Where the moon is, parent planet's orbit included; without an
+	 * orbit store the planet's own rotation is not known
+	 */
+	vector3<float> get_world_position() const {
+		if (orbits != NULL) {
+			return orbits->get_world_position(orbit_index);
+		}
+		return parent_position + get_position();
+	}
+
+	vector3<float> get_enclosing_center() const {
+		return parent_position + get_position();
+	}
+
+	vector3<float> get_previous_enclosing_center() const {
+		return previous_parent_position + object3d::get_previous_enclosing_center();
+	}
+
+	void save_state() {
+		object3d::save_state();
+		previous_parent_position = parent_position;
+	}
+
 	bool collide_with(const object3d *other) const {
 		if (util::math3d::distance(parent_position + get_position(), other->get_position()) <= (get_bounding_sphere_radius() + other->get_bounding_sphere_radius())) {
 			return true;	
@@ -83,12 +157,25 @@ public:
 		return false;
 	}
 
+protected:
+	void submit_sphere(util::instance_renderer &instances, const util::matrix4 &parent) {
+		util::matrix4 model(parent);
+		model.multiply(RM);
+		const util::lod_level &level = lod.select(instances.projected_radius(radius, model));
+		model.scale(radius, radius, radius);
+		instances.add(util::sphere_cache::get(level.slices, level.stacks, false), model, get_color(color));
+	}
+
 protected:
 	float radius;
 	float angle;
 	float degree;
 	color_name color;
 	vector3<float> parent_position;
+	vector3<float> previous_parent_position;
+	util::orbit_store *orbits;
+	int orbit_index;
+	util::lod_selector lod;
 };
 
 #endif
\ No newline at end of file
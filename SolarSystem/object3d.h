@@ -6,12 +6,11 @@
 #include <sstream>
 #include <iomanip>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "vector3.h"
 #include "math3d.h"
+#include "matrix4.h"
 #include "colors.h"
 
 using namespace std;
@@ -43,11 +42,20 @@ public:
 
 	static const int AXIS_LENGTH = 5000;
 
+	/* jumps longer than this between two steps are drawn without blending */
+	static const int SNAP_DISTANCE = 3000;
+
 public:
 	virtual ~object3d() {
 
 	}
 
+private:
+	// OM may point into this object, copying would alias it
+	object3d(const object3d &o);
+	object3d& operator =(const object3d &o);
+
+public:
 	object3d(const string &name = "object3d", float bd_radius = 0.0f, bool collidable = false):
 		name(name), 
 		bounding_sphere_radius(bd_radius), 
@@ -58,10 +66,13 @@ public:
 		bounding_sphere(false),
 		pitch(0.0f), yaw(0.0f), roll(0.0f) {
 
+		OM = own_OM;
 		initialize(OM);
 		for (int i = 0; i < 3; ++i) {
 			position[i] = 0;
 		}
+		save_state();
+		interpolate(1.0f);
 	}
 
 	object3d(const string &name, float bd_radius, bool collidable, const vector3<float> &position, const vector3<float> &forward):
@@ -76,6 +87,7 @@ public:
 		forward(forward),
 		pitch(0.0f), yaw(0.0f), roll(0.0f) {
 
+		OM = own_OM;
 		initialize(OM);
 
 		MV[Tx] = position.get_x();
@@ -85,6 +97,9 @@ public:
 		OM[Tx] = position.get_x();
 		OM[Ty] = position.get_y();
 		OM[Tz] = position.get_z();
+
+		save_state();
+		interpolate(1.0f);
 	}
 
 	/**
@@ -118,6 +133,42 @@ public:
 		return bounding_sphere_radius;
 	}
 
+	/**
+	 * Sphere that encloses everything collide_with() can hit,
+	 * used by the broadphase. Override together with collide_with().
+	 */
+	virtual vector3<float> get_enclosing_center() const {
+		return get_position();
+	}
+
+	virtual float get_enclosing_radius() const {
+		return bounding_sphere_radius;
+	}
+
+	/**
+	 * get_enclosing_center() at the previous step. A jump longer than
+	 * SNAP_DISTANCE is a teleport or respawn, the object did not travel it.
+	 */
+	virtual vector3<float> get_previous_enclosing_center() const {
+		vector3<float> now = get_position();
+		vector3<float> before(PM[Tx], PM[Ty], PM[Tz]);
+		if ((now - before).length() > SNAP_DISTANCE) {
+			return now;
+		}
+		return before;
+	}
+
+	/**
+	 * Continuous version of collide_with(): sweeps both bounding spheres
+	 * from the previous step to this one, so fast objects can't tunnel
+	 * through small ones. toi is the earliest contact in [0, 1].
+	 */
+	virtual bool sweep_with(const object3d *obj, float &toi) const {
+		return util::math3d::sweep_spheres(
+			get_previous_enclosing_center(), get_enclosing_center(), bounding_sphere_radius,
+			obj->get_previous_enclosing_center(), obj->get_enclosing_center(), obj->get_bounding_sphere_radius(), toi);
+	}
+
 	virtual void draw_bounding_sphere() {
 		glPushMatrix(); 
         glColor3fv(get_color(colors::white));
@@ -125,39 +176,94 @@ public:
         glPopMatrix();
 	}
 
+	/**
+	 * Compute the orientation matrix OM on the CPU.
+	 * Same transform the old GL push/rotate/glGetFloatv sequence
+	 * produced, without stalling the pipeline on a readback.
+	 */
 	void update_internal() {
-		glMatrixMode(GL_MODELVIEW);
-		glPushMatrix(); {
-			// make the current identity
-			glLoadIdentity();
-			// perform rotation and translation
-			if (rotate_about == false) { 
-				glTranslatef(position.get_x(), position.get_y(), position.get_z());
-				glRotatef(roll, 0, 0, 1);
-				glRotatef(yaw, 0, 1, 0);
-				glRotatef(pitch, 1, 0, 0);
-			} else {
-				glRotatef(roll, 0, 0, 1);
-				glRotatef(yaw, 0, 1, 0);
-				glRotatef(pitch, 1, 0, 0);
-				glTranslatef(position.get_x(), position.get_y(), position.get_z());
-			}
-			// save the actual MV without affecting camera 
-			glGetFloatv(GL_MODELVIEW_MATRIX, OM);
-		} glPopMatrix();
+		matrix4 m;
+		if (rotate_about == false) {
+			m.translate(position.get_x(), position.get_y(), position.get_z());
+			m.rotate_z(roll);
+			m.rotate_y(yaw);
+			m.rotate_x(pitch);
+		} else {
+			m.rotate_z(roll);
+			m.rotate_y(yaw);
+			m.rotate_x(pitch);
+			m.translate(position.get_x(), position.get_y(), position.get_z());
+		}
+		m.copy_to(OM);
 	}
 
 	void update_smart_movement(const vector3<float> &target) {
 		vector3<float> pos = position;
 		vector3<float> axis = pos.cross(target);
 		axis.normalize();
-		glMatrixMode(GL_MODELVIEW);
-		glPushMatrix(); {
-			glLoadIdentity();
-			glRotatef(1.0f, axis.get_x(), axis.get_y(), axis.get_z());
-			glTranslatef(position.get_x(), position.get_y(), position.get_z());
-			glGetFloatv(GL_MODELVIEW_MATRIX, OM);
-		} glPopMatrix();
+		matrix4 m;
+		m.rotate(1.0f, axis.get_x(), axis.get_y(), axis.get_z());
+		m.translate(position.get_x(), position.get_y(), position.get_z());
+		m.copy_to(OM);
+	}
+
+	/**
+	 * Make OM live in external storage (e.g. a slot of util::orbit_store)
+	 * so it can be updated by a batched kernel. The storage must outlive
+	 * this object and already hold the current transform.
+	 */
+	void bind_orientation(float *m) {
+		OM = m;
+		save_state();
+		interpolate(1.0f);
+	}
+
+	bool is_orientation_bound() const {
+		return OM != own_OM;
+	}
+
+	/**
+	 * Remember OM before a simulation step so rendering
+	 * can blend between the last two steps
+	 */
+	virtual void save_state() {
+		memcpy(PM, OM, sizeof(PM));
+	}
+
+	/**
+	 * Compute RM, the matrix used for drawing, between the previous (alpha = 0)
+	 * and the current (alpha = 1) step. Teleports and respawns are not blended.
+	 */
+	void interpolate(float alpha) {
+		float dx = OM[Tx] - PM[Tx];
+		float dy = OM[Ty] - PM[Ty];
+		float dz = OM[Tz] - PM[Tz];
+		if (alpha >= 1.0f || dx * dx + dy * dy + dz * dz > SNAP_DISTANCE * SNAP_DISTANCE) {
+			memcpy(RM, OM, sizeof(RM));
+			return;
+		}
+		for (int i = 0; i < 16; ++i) {
+			RM[i] = PM[i] + (OM[i] - PM[i]) * alpha;
+		}
+	}
+
+	/**
+	 * Matrix to pass to glMultMatrixf() when drawing
+	 */
+	const float *get_render_matrix() const {
+		return RM;
+	}
+
+	vector3<float> get_render_position() const {
+		return vector3<float>(RM[Tx], RM[Ty], RM[Tz]);
+	}
+
+	vector3<float> get_render_forward() const {
+		return vector3<float>(RM[Ax], RM[Ay], RM[Az]);
+	}
+
+	vector3<float> get_render_up() const {
+		return vector3<float>(RM[Ux], RM[Uy], RM[Uz]);
 	}
 
 	void draw_axes() {
@@ -280,6 +386,13 @@ public:
 		bounding_sphere = flag;
 	}
 
+	/**
+	 * Whether draw() puts anything over the object itself
+	 */
+	bool has_overlays() const {
+		return (collidable && bounding_sphere) || debug_on;
+	}
+
 	void draw() {
 		if (collidable && bounding_sphere) {
 			draw_bounding_sphere();
@@ -350,7 +463,10 @@ protected:
 	bool solid;
 	bool debug_on;
 
-	float OM[16]; // orientation matrix 
+	float *OM; // orientation matrix, own_OM unless bound to a batched store
+	float own_OM[16];
+	float PM[16]; // orientation matrix at the previous simulation step
+	float RM[16]; // interpolated orientation matrix used for drawing
 	float MV[16]; // modelview matrix
 
 	vector3<float> position;
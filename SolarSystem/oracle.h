@@ -2,9 +2,7 @@
 #define ORACLE_H
 
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include <vector>
 #include <string>
@@ -64,10 +62,8 @@ public:
 
     void draw() {
         glPushMatrix(); {
-            // save it for moons
-            glGetFloatv(GL_MODELVIEW_MATRIX, camera_view);
             // update
-            glMultMatrixf(OM);
+            glMultMatrixf(RM);
             // actual rendering
             draw_itself();
             // draw axis or bounding sphere
@@ -97,7 +93,6 @@ private:
     float radius;
     float degree;
     color_name color;
-    float camera_view[16];
 };
 
 #endif
\ No newline at end of file
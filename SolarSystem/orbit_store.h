@@ -0,0 +1,188 @@
+#ifndef __SOLAR_SYSTEM_ORBIT_STORE_H
+#define __SOLAR_SYSTEM_ORBIT_STORE_H
+
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <cassert>
+
+#include "vector3.h"
+#include "math3d.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Structure-of-arrays storage for bodies that orbit their parent
+	 * (planets around the sun, moons around planets).
+	 *
+	 * All state lives in flat arrays indexed by body, and update() advances
+	 * every body with a few linear passes instead of a virtual update() per
+	 * heap object. planet and moon bind their OM to get_local(i), so they are
+	 * thin views over this store.
+	 *
+	 * Parents must be added before their children.
+	 */
+	class orbit_store {
+	public:
+		static const int NO_PARENT = -1;
+
+	public:
+		void reserve(size_t n) {
+			angle.reserve(n);
+			rate.reserve(n);
+			offset_x.reserve(n);
+			offset_y.reserve(n);
+			offset_z.reserve(n);
+			parent.reserve(n);
+			sin_angle.reserve(n);
+			cos_angle.reserve(n);
+			local.reserve(n * 16);
+			world.reserve(n * 16);
+		}
+
+		/**
+		 * Add a body orbiting "parent" at "offset", turning "degree" degrees
+		 * per step. Returns its index. Pointers from get_local() and
+		 * get_world() are invalidated by add().
+		 */
+		int add(float degree, const vector3<float> &offset, int parent_index = NO_PARENT) {
+			assert(parent_index < static_cast<int>(size()));
+			angle.push_back(0.0f);
+			rate.push_back(degree);
+			offset_x.push_back(offset.get_x());
+			offset_y.push_back(offset.get_y());
+			offset_z.push_back(offset.get_z());
+			parent.push_back(parent_index);
+			sin_angle.push_back(0.0f);
+			cos_angle.push_back(1.0f);
+
+			// rotation about y followed by the offset, y never changes
+			const float m[16] = {
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, 1.0f, 0.0f,
+				offset.get_x(), offset.get_y(), offset.get_z(), 1.0f
+			};
+			local.insert(local.end(), m, m + 16);
+			world.insert(world.end(), m, m + 16);
+			update_world(size() - 1);
+			return static_cast<int>(size() - 1);
+		}
+
+		size_t size() const {
+			return angle.size();
+		}
+
+		/**
+		 * Advance every body by one step
+		 */
+		void update() {
+			const size_t n = size();
+			if (n == 0) {
+				return;
+			}
+			float *a = &angle[0];
+			const float *r = &rate[0];
+			float *s = &sin_angle[0];
+			float *c = &cos_angle[0];
+			const float *ox = &offset_x[0];
+			const float *oz = &offset_z[0];
+
+			// 1. advance angles
+			for (size_t i = 0; i < n; ++i) {
+				const float next = a[i] + r[i];
+				a[i] = (next >= 360.0f) ? 0.0f : next;
+			}
+
+			// 2. sine and cosine of every angle
+			for (size_t i = 0; i < n; ++i) {
+				const float radians = a[i] * constants::PI / 180.0f;
+				s[i] = sinf(radians);
+				c[i] = cosf(radians);
+			}
+
+			// 3. local transform: rotate about y, then translate by the offset
+			float *m = &local[0];
+			for (size_t i = 0; i < n; ++i, m += 16) {
+				m[0] = c[i];
+				m[2] = -s[i];
+				m[8] = s[i];
+				m[10] = c[i];
+				m[12] = c[i] * ox[i] + s[i] * oz[i];
+				m[14] = -s[i] * ox[i] + c[i] * oz[i];
+			}
+
+			// 4. world transform, parents come first
+			for (size_t i = 0; i < n; ++i) {
+				update_world(i);
+			}
+		}
+
+		/**
+		 * Local transform of body i, in the same layout as object3d::OM
+		 */
+		float *get_local(int i) {
+			return &local[i * 16];
+		}
+
+		const float *get_world(int i) const {
+			return &world[i * 16];
+		}
+
+		vector3<float> get_world_position(int i) const {
+			const float *m = get_world(i);
+			return vector3<float>(m[12], m[13], m[14]);
+		}
+
+		int get_parent(int i) const {
+			return parent[i];
+		}
+
+		float get_angle(int i) const {
+			return angle[i];
+		}
+
+		float get_rate(int i) const {
+			return rate[i];
+		}
+
+		void set_rate(int i, float degree) {
+			rate[i] = degree;
+		}
+
+	private:
+		void update_world(size_t i) {
+			const float *l = &local[i * 16];
+			float *w = &world[i * 16];
+			if (parent[i] == NO_PARENT) {
+				memcpy(w, l, 16 * sizeof(float));
+				return;
+			}
+			const float *p = &world[parent[i] * 16];
+			for (int col = 0; col < 4; ++col) {
+				for (int row = 0; row < 4; ++row) {
+					w[col * 4 + row] =
+						p[row] * l[col * 4 + 0] +
+						p[4 + row] * l[col * 4 + 1] +
+						p[8 + row] * l[col * 4 + 2] +
+						p[12 + row] * l[col * 4 + 3];
+				}
+			}
+		}
+
+	private:
+		vector<float> angle;		// degrees about the parent's y axis
+		vector<float> rate;			// degrees per step
+		vector<float> offset_x;		// offset from the parent
+		vector<float> offset_y;
+		vector<float> offset_z;
+		vector<int> parent;			// index of the parent or NO_PARENT
+		vector<float> sin_angle;	// scratch for the batched pass
+		vector<float> cos_angle;
+		vector<float> local;		// 16 floats per body, column-major
+		vector<float> world;		// 16 floats per body, column-major
+	};
+}
+
+#endif
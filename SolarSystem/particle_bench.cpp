@@ -0,0 +1,151 @@
+//
+//  particle_bench.cpp
+//  SolarSystem
+//
+//  Headless benchmark of particle_engine: times the simulation step,
+//  the depth sort and the vertex generation separately for a range of
+//  particle counts. Build with SOLAR_SYSTEM_HEADLESS, the GL calls of
+//  draw() are stubs so no context is needed.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "particle_engine.h"
+
+using namespace std;
+
+/**
+ * Drives one engine a stage at a time; a friend of particle_engine so
+ * it can reach step() and the sort without going through draw()
+ */
+class particle_bench {
+public:
+    struct timings {
+        vector<double> step;
+        vector<double> sort;
+        vector<double> vertices;
+    };
+
+public:
+    particle_bench(size_t count, util::job_system *jobs, uint64_t seed):
+    engine("bench", 0, 1.0f, 4.5f, count) {
+        engine.set_seed(seed);
+        engine.set_job_system(jobs);
+    }
+
+    size_t size() const {
+        return engine.size();
+    }
+
+    /**
+     * Run "iterations" frames of one step, one sort and one vertex build,
+     * collecting ns per live particle for each stage
+     */
+    timings run(int iterations) {
+        timings t;
+        for (int i = 0; i < iterations; ++i) {
+            const double n = static_cast<double>(max<size_t>(engine.size(), 1));
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            engine.step();
+            chrono::steady_clock::time_point stepped = chrono::steady_clock::now();
+            engine.sort_by_depth(camera.get());
+            chrono::steady_clock::time_point sorted = chrono::steady_clock::now();
+            engine.build_vertices(camera.get());
+            chrono::steady_clock::time_point built = chrono::steady_clock::now();
+            t.step.push_back(chrono::duration<double, nano>(stepped - start).count() / n);
+            t.sort.push_back(chrono::duration<double, nano>(sorted - stepped).count() / n);
+            t.vertices.push_back(chrono::duration<double, nano>(built - sorted).count() / n);
+        }
+        return t;
+    }
+
+private:
+    particle_engine engine;
+    // looking down -z at the fountain
+    util::matrix4 camera;
+};
+
+namespace benchmark {
+    void usage(const char *program) {
+        cout << "usage: " << program << " [-p particles]... [-i iterations] [-j workers] [-s seed]\n";
+        cout << "  -p particles engine capacity, repeat for several (default 1000 10000 100000 1000000)\n";
+        cout << "  -i iterations frames timed per capacity (default 200)\n";
+        cout << "  -j workers   job threads besides the main one (default 0)\n";
+        cout << "  -s seed      particle random seed (default 1)\n";
+    }
+
+    double percentile(vector<double> samples, double p) {
+        sort(samples.begin(), samples.end());
+        size_t i = static_cast<size_t>(p * (samples.size() - 1) + 0.5);
+        return samples[i];
+    }
+
+    void report(const char *stage, const vector<double> &samples) {
+        cout << setw(10) << left << stage << right
+             << setw(10) << percentile(samples, 0.5)
+             << setw(10) << percentile(samples, 0.9)
+             << setw(10) << percentile(samples, 0.99)
+             << setw(10) << percentile(samples, 1.0) << '\n';
+    }
+
+    int run(int argc, char **argv) {
+        vector<long> counts;
+        int iterations = 200;
+        long workers = 0;
+        uint64_t seed = 1;
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+                counts.push_back(atol(argv[++i]));
+            } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+                iterations = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+                workers = atol(argv[++i]);
+            } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+                seed = strtoull(argv[++i], NULL, 10);
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+        if (counts.empty()) {
+            counts.push_back(1000);
+            counts.push_back(10000);
+            counts.push_back(100000);
+            counts.push_back(1000000);
+        }
+        if (iterations < 1 || workers < 0) {
+            usage(argv[0]);
+            return 1;
+        }
+
+        util::job_system jobs(static_cast<unsigned>(workers));
+        cout << fixed << setprecision(2);
+        for (size_t c = 0; c < counts.size(); ++c) {
+            if (counts[c] < 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            particle_bench bench(static_cast<size_t>(counts[c]), &jobs, seed);
+            particle_bench::timings t = bench.run(iterations);
+            cout << "particles: " << counts[c] << " live: " << bench.size()
+                 << " workers: " << jobs.get_workers() << " iterations: " << iterations << '\n';
+            cout << setw(10) << left << "ns/part." << right
+                 << setw(10) << "p50" << setw(10) << "p90" << setw(10) << "p99" << setw(10) << "max" << '\n';
+            report("step", t.step);
+            report("sort", t.sort);
+            report("vertices", t.vertices);
+            cout << '\n';
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    return benchmark::run(argc, argv);
+}
@@ -0,0 +1,188 @@
+#ifndef __SOLAR_SYSTEM_PARTICLE_BUFFER_H
+#define __SOLAR_SYSTEM_PARTICLE_BUFFER_H
+
+#include <vector>
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Structure-of-arrays particle pool: one flat array per attribute,
+	 * so the integration step streams through memory and vectorizes.
+	 * Colour is packed RGBA8 (alpha unused, it comes from the age).
+	 *
+	 * Live particles are kept packed in [0, size()). spawn() takes the
+	 * first free slot past them and kill() moves the last live particle
+	 * into the hole, so the free slots always form the tail and dead
+	 * particles cost nothing to step, sort or draw.
+	 */
+	struct particle_buffer {
+		vector<float> px, py, pz;		// position
+		vector<float> vx, vy, vz;		// velocity
+		vector<float> age;				// time alive so far
+		vector<float> life;				// total time to live
+		vector<float> gravity;			// pull down y, per particle
+		vector<unsigned> rgba;			// packed colour
+		vector<int> emitter;			// who spawned it
+		vector<unsigned char> expired;	// set by step_particles()
+
+		particle_buffer():
+			live(0) {
+		}
+
+		/**
+		 * Change the number of slots, particles past the new
+		 * capacity are dropped
+		 */
+		void reserve(size_t n) {
+			px.resize(n), py.resize(n), pz.resize(n);
+			vx.resize(n), vy.resize(n), vz.resize(n);
+			age.resize(n), life.resize(n), gravity.resize(n);
+			rgba.resize(n);
+			emitter.resize(n);
+			expired.resize(n);
+			if (live > n) {
+				live = n;
+			}
+		}
+
+		size_t capacity() const {
+			return px.size();
+		}
+
+		/**
+		 * Number of live particles
+		 */
+		size_t size() const {
+			return live;
+		}
+
+		bool full() const {
+			return live == capacity();
+		}
+
+		/**
+		 * Slot for a new particle, the caller fills every attribute.
+		 * Only valid when !full().
+		 */
+		size_t spawn() {
+			return live++;
+		}
+
+		void kill(size_t i) {
+			const size_t last = --live;
+			if (i != last) {
+				px[i] = px[last], py[i] = py[last], pz[i] = pz[last];
+				vx[i] = vx[last], vy[i] = vy[last], vz[i] = vz[last];
+				age[i] = age[last], life[i] = life[last], gravity[i] = gravity[last];
+				rgba[i] = rgba[last];
+				emitter[i] = emitter[last];
+				expired[i] = expired[last];
+			}
+		}
+
+		void clear() {
+			live = 0;
+		}
+
+		static unsigned pack_color(float r, float g, float b) {
+			return to_byte(r) | (to_byte(g) << 8) | (to_byte(b) << 16) | (255u << 24);
+		}
+
+		static void unpack_color(unsigned c, float &r, float &g, float &b) {
+			r = (c & 0xff) / 255.0f;
+			g = ((c >> 8) & 0xff) / 255.0f;
+			b = ((c >> 16) & 0xff) / 255.0f;
+		}
+
+	private:
+		static unsigned to_byte(float v) {
+			v = (v < 0.0f) ? 0.0f : ((v > 1.0f) ? 1.0f : v);
+			return static_cast<unsigned>(v * 255.0f + 0.5f);
+		}
+
+	private:
+		size_t live;
+	};
+
+	/**
+	 * Remove every particle step_particles() marked as expired in
+	 * [begin, size()), returns how many were removed
+	 */
+	inline size_t remove_expired(particle_buffer &b, size_t begin = 0) {
+		size_t removed = 0;
+		// walk down so whatever kill() moves into i was already checked
+		for (size_t i = b.size(); i-- > begin; ) {
+			if (b.expired[i]) {
+				b.kill(i);
+				++removed;
+			}
+		}
+		return removed;
+	}
+
+	/**
+	 * One corner of a particle quad, interleaved for glDrawArrays()
+	 */
+	struct particle_vertex {
+		float x, y, z;
+		unsigned char r, g, b, a;
+		float u, v;
+	};
+
+	/**
+	 * Integrate particles [begin, end) by dt under their own gravity:
+	 * position += velocity * dt, velocity.y -= gravity * dt, age += dt.
+	 * Marks expired[i] for every particle that outlived its life and
+	 * returns how many did, respawning is up to the caller.
+	 *
+	 * 8 particles per instruction with AVX2, scalar elsewhere.
+	 */
+	inline size_t step_particles(particle_buffer &b, size_t begin, size_t end, float dt) {
+		if (begin >= end) {
+			return 0;
+		}
+		float *px = &b.px[0], *py = &b.py[0], *pz = &b.pz[0];
+		float *vx = &b.vx[0], *vy = &b.vy[0], *vz = &b.vz[0];
+		float *age = &b.age[0];
+		const float *life = &b.life[0];
+		const float *gravity = &b.gravity[0];
+		unsigned char *expired = &b.expired[0];
+		size_t count = 0;
+		size_t i = begin;
+#if defined(__AVX2__)
+		const __m256 step = _mm256_set1_ps(dt);
+		for (; i + 8 <= end; i += 8) {
+			__m256 y = _mm256_loadu_ps(vy + i);
+			_mm256_storeu_ps(px + i, _mm256_add_ps(_mm256_loadu_ps(px + i), _mm256_mul_ps(_mm256_loadu_ps(vx + i), step)));
+			_mm256_storeu_ps(py + i, _mm256_add_ps(_mm256_loadu_ps(py + i), _mm256_mul_ps(y, step)));
+			_mm256_storeu_ps(pz + i, _mm256_add_ps(_mm256_loadu_ps(pz + i), _mm256_mul_ps(_mm256_loadu_ps(vz + i), step)));
+			_mm256_storeu_ps(vy + i, _mm256_sub_ps(y, _mm256_mul_ps(_mm256_loadu_ps(gravity + i), step)));
+			__m256 a = _mm256_add_ps(_mm256_loadu_ps(age + i), step);
+			_mm256_storeu_ps(age + i, a);
+			int mask = _mm256_movemask_ps(_mm256_cmp_ps(a, _mm256_loadu_ps(life + i), _CMP_GT_OQ));
+			for (int k = 0; k < 8; ++k) {
+				expired[i + k] = (mask >> k) & 1;
+			}
+			count += __builtin_popcount(mask);
+		}
+#endif
+		for (; i < end; ++i) {
+			px[i] += vx[i] * dt;
+			py[i] += vy[i] * dt;
+			pz[i] += vz[i] * dt;
+			vy[i] -= gravity[i] * dt;
+			age[i] += dt;
+			expired[i] = (age[i] > life[i]) ? 1 : 0;
+			count += expired[i];
+		}
+		return count;
+	}
+}
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef __SOLAR_SYSTEM_PARTICLE_EMITTER_H
+#define __SOLAR_SYSTEM_PARTICLE_EMITTER_H
+
+#include <vector>
+#include <cmath>
+
+#include "vector3.h"
+#include "math3d.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Everything that shapes what an emitter spawns. Directions and
+	 * positions are in the particle engine's space.
+	 */
+	struct emitter_settings {
+		vector3<float> origin;			// where particles start
+		vector3<float> direction;		// axis of the velocity cone
+		float spread;					// half angle of the cone, radians
+		float speed_min, speed_max;		// initial speed range
+		float spin;						// radians per second the cone turns about y
+		float rate;						// particles per second, 0 = off
+		float life_min, life_max;		// lifetime range, seconds
+		float gravity;					// pull down y
+		vector<vector3<float> > colors;	// colour ramp, sampled at spawn time
+		float color_period;				// seconds to run through the ramp once
+
+		emitter_settings():
+			origin(0, 0, 0),
+			direction(0, 1, 0),
+			spread(0.1f),
+			speed_min(1.0f),
+			speed_max(1.0f),
+			spin(0.0f),
+			rate(100.0f),
+			life_min(1.0f),
+			life_max(2.0f),
+			gravity(0.0f),
+			colors(1, vector3<float>(1, 1, 1)),
+			color_period(1.0f) {
+		}
+
+		/**
+		 * The fountain the sun used to have hard-coded: a cone turning
+		 * about y and a colour ramp around the hue wheel every 10 s
+		 */
+		static emitter_settings fountain(float gravity, float rate) {
+			emitter_settings s;
+			s.direction = vector3<float>(1, 1, 0);
+			s.spread = 0.1f;
+			s.speed_min = 2.6f;
+			s.speed_max = 3.0f;
+			s.spin = 0.5f;
+			s.rate = rate;
+			s.life_min = 1.0f;
+			s.life_max = 2.0f;
+			s.gravity = gravity;
+			s.colors.clear();
+			s.colors.push_back(vector3<float>(1, 0, 0));
+			s.colors.push_back(vector3<float>(1, 1, 0));
+			s.colors.push_back(vector3<float>(0, 1, 0));
+			s.colors.push_back(vector3<float>(0, 1, 1));
+			s.colors.push_back(vector3<float>(0, 0, 1));
+			s.colors.push_back(vector3<float>(1, 0, 1));
+			s.colors.push_back(vector3<float>(1, 0, 0));
+			s.color_period = 10.0f;
+			return s;
+		}
+	};
+
+	/**
+	 * One emitter: its settings plus the running clock and the fraction
+	 * of a particle owed from previous steps
+	 */
+	class particle_emitter {
+	public:
+		particle_emitter(const emitter_settings &settings = emitter_settings()):
+			settings(settings),
+			clock(0.0f),
+			owed(0.0f),
+			active(true) {
+		}
+
+		/**
+		 * Advance by dt, returns how many particles are due. "detail"
+		 * scales the rate down for a far away view.
+		 */
+		int advance(float dt, float detail = 1.0f) {
+			clock += dt;
+			if (!active || settings.rate <= 0.0f) {
+				owed = 0.0f;
+				return 0;
+			}
+			owed += settings.rate * detail * dt;
+			int due = static_cast<int>(owed);
+			owed -= due;
+			return due;
+		}
+
+		/**
+		 * Colour for a particle spawned now
+		 */
+		vector3<float> get_color() const {
+			const vector<vector3<float> > &ramp = settings.colors;
+			if (ramp.size() < 2 || settings.color_period <= 0.0f) {
+				return ramp.empty() ? vector3<float>(1, 1, 1) : ramp[0];
+			}
+			float phase = fmodf(clock / settings.color_period, 1.0f) * (ramp.size() - 1);
+			size_t k = static_cast<size_t>(phase);
+			if (k >= ramp.size() - 1) {
+				k = ramp.size() - 2;
+			}
+			float t = phase - k;
+			return ramp[k] * (1.0f - t) + ramp[k + 1] * t;
+		}
+
+		/**
+		 * Velocity for a particle spawned now, u, v and w uniform in [0, 1)
+		 */
+		vector3<float> get_velocity(float u, float v, float w) const {
+			vector3<float> axis = settings.direction.normal();
+			if (settings.spin != 0.0f) {
+				float a = settings.spin * clock;
+				float c = cosf(a), s = sinf(a);
+				axis = vector3<float>(c * axis[0] - s * axis[2], axis[1], s * axis[0] + c * axis[2]);
+			}
+			// uniform direction inside the cone around axis
+			float cos_theta = 1.0f - u * (1.0f - cosf(settings.spread));
+			float sin_theta = sqrtf(fmaxf(0.0f, 1.0f - cos_theta * cos_theta));
+			float phi = v * 2.0f * constants::PI;
+			vector3<float> side = axis.orthogonal().normal();
+			vector3<float> up = axis.cross(side);
+			vector3<float> dir = axis * cos_theta + (side * cosf(phi) + up * sinf(phi)) * sin_theta;
+			float speed = settings.speed_min + w * (settings.speed_max - settings.speed_min);
+			return dir * speed;
+		}
+
+		/**
+		 * Lifetime for a particle spawned now, u uniform in [0, 1)
+		 */
+		float get_life(float u) const {
+			return settings.life_min + u * (settings.life_max - settings.life_min);
+		}
+
+	public:
+		emitter_settings settings;
+		float clock;
+		float owed;
+		bool active;
+	};
+}
+
+#endif
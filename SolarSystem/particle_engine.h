@@ -8,73 +8,223 @@
 #include <cmath>
 #include <cstdlib>
 #include <vector>
+#include <cstddef>
+#include <cstring>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "vector3.h"
 #include "drawable.h"
 #include "movable.h"
 #include "math3d.h"
 #include "object3d.h"
+#include "particle_buffer.h"
+#include "particle_emitter.h"
+#include "radix_sort.h"
+#include "random.h"
+#include "job_system.h"
+#include "vertex_stream.h"
+#include "screen_lod.h"
+#include "gl_state.h"
 
 using namespace std;
 
-const int NUM_PARTICLES = 2000;
+/**
+ * The fountain is tilted 30 degrees about x, built once
+ */
+const matrix4 &particle_tilt() {
+    static matrix4 tilt;
+    static bool built = false;
+    if (!built) {
+        tilt.rotate_x(30.0f);
+        built = true;
+    }
+    return tilt;
+}
 
 vector3<float> adjust_particle_pos(const vector3<float> &pos) {
-    vector3<float> axis(1, 0, 0);
-    return math3d::rotate<float>(pos, axis, -30.0f);
+    return math3d::rotate(particle_tilt(), pos);
 }
 
-float random_float() {
-    return (float)rand() / ((float)RAND_MAX + 1);
-}
+class particle_engine : public object3d, public drawable, public movable {
+    /* times step(), the sort and the vertices on their own, see particle_bench.cpp */
+    friend class particle_bench;
 
-struct particle {
-    vector3<float> position;
-    vector3<float> velocity;
-    vector3<float> color;
-    float time_alive;		// the amount of time that this particle has been alive.
-    float life_span;		// the total amount of time that this particle is to live.
+private:
+    enum chunk_pass {
+        STEP_PASS,
+        SPAWN_PASS
+    };
 
-public:
-    bool operator <(const particle &rhs) const {
-        return adjust_particle_pos(position)[2] < adjust_particle_pos(rhs.position)[2];
-    }
+    /**
+     * Back to front order of the particles for one view, with the step
+     * and the camera's forward axis it was built for
+     */
+    struct depth_order {
+        radix_sorter sorter;
+        long steps;
+        float axis[3];
+        // which build of an order this is, 0 before the first
+        long version;
 
-    bool operator >(const particle &rhs) const {
-        return adjust_particle_pos(position)[2] > adjust_particle_pos(rhs.position)[2];
-    }
-};
+        depth_order():
+        steps(-1),
+        version(0) {
+            axis[0] = axis[1] = axis[2] = 0.0f;
+        }
+    };
 
-class particle_engine : public object3d, public drawable, public movable {
+public:
+    /* seconds advanced by update() when the caller has no clock */
+    static constexpr float DEFAULT_FRAME_TIME = 0.04f;
+    /* particles shared by all emitters unless set_capacity() says otherwise */
+    static const size_t DEFAULT_CAPACITY = 2000;
+    /* particles per job; results do not depend on how chunks land on threads */
+    static const size_t CHUNK_SIZE = 4096;
+    /* radius of the default fountain in its own units, before scale_factor */
+    static constexpr float BOUND_RADIUS = 5.0f;
+    /* screen radius in pixels under which the fountain is not drawn */
+    static constexpr float CULL_PIXELS = 1.5f;
+    /* under this the particles are too small for the draw order to show */
+    static constexpr float SORT_PIXELS = 48.0f;
+    /* from this up every emitter spawns at its full rate */
+    static constexpr float FULL_DETAIL_PIXELS = 256.0f;
+    /* emitters never drop below this share of their rate */
+    static constexpr float MIN_DETAIL = 0.05f;
 
 public:
-    particle_engine(const string &name, unsigned t_id = 0, float scale_factor = 5000.0f, float gravity = 3.0f) :
+    /**
+     * Starts with a single fountain emitter pulled down by "gravity" that
+     * keeps about "capacity" particles alive, warmed up for 5 seconds.
+     */
+    particle_engine(const string &name, unsigned t_id = 0, float scale_factor = 5000.0f, float gravity = 3.0f, size_t capacity = DEFAULT_CAPACITY) :
     object3d("particle engine"),
+    texture_id(t_id),
     texture_on(false),
     step_time(0.01f),
     particle_size(0.05f),
-    time_until_next_step(0.0f),
-    color_time(0),
-    angle(0.0f),
-    texture_id(t_id),
     scale_factor(scale_factor),
-    gravity(gravity) {
-        for (int i = 0; i < NUM_PARTICLES; ++i) {
-            create_particle(particles + i);
-        }
+    time_until_next_step(0.0f),
+    steps(0),
+    tilted_steps(-1),
+    orders_built(0),
+    built_steps(-1),
+    built_order(0),
+    detail(1.0f),
+    view_pixels(-1.0f),
+    bound_radius(BOUND_RADIUS),
+    jobs(NULL),
+    seed(1) {
+        set_capacity(capacity);
+        // particles live 1.5 s on average, so this rate keeps the pool full
+        add_emitter(emitter_settings::fountain(gravity, capacity / 1.5f));
         for (int i = 0; i < (5.0f / step_time); ++i) {
             step();
         }
     }
 
+    /**
+     * Number of particles all emitters share. Emitters stop spawning
+     * while the pool is full; shrinking it drops the newest particles.
+     */
+    void set_capacity(size_t capacity) {
+        particles.reserve(capacity);
+        tilted.resize(capacity);
+        depth.resize(capacity);
+        vertices.resize(capacity * 4);
+        tilted_steps = built_steps = -1;
+        for (int v = 0; v < util::lod::MAX_VIEWS; ++v) {
+            orders[v].steps = -1;
+        }
+        setup_chunk_jobs();
+    }
+
+    size_t get_capacity() const {
+        return particles.capacity();
+    }
+
+    /**
+     * Number of live particles
+     */
+    size_t size() const {
+        return particles.size();
+    }
+
+    /**
+     * Step chunks of particles on these workers, NULL steps inline.
+     * update() must not be called from inside a job of the same system.
+     */
+    void set_job_system(util::job_system *jobs) {
+        this->jobs = jobs;
+    }
+
+    /**
+     * Key for the random streams of new particles; the same seed gives
+     * the same particles whatever the number of workers
+     */
+    void set_seed(uint64_t seed) {
+        this->seed = seed;
+    }
+
+    /**
+     * Start a new emitter, returns its id
+     */
+    int add_emitter(const emitter_settings &settings) {
+        emitters.push_back(particle_emitter(settings));
+        return static_cast<int>(emitters.size() - 1);
+    }
+
+    /**
+     * Settings of emitter id, changes apply to particles spawned from now on
+     */
+    emitter_settings &get_emitter(int id) {
+        return emitters[id].settings;
+    }
+
+    size_t get_emitter_count() const {
+        return emitters.size();
+    }
+
+    /**
+     * Pause or resume spawning, live particles carry on either way
+     */
+    void set_emitter_active(int id, bool active) {
+        emitters[id].active = active;
+    }
+
+    /**
+     * Radius of everything the emitters reach in the engine's own units,
+     * used to size the fountain on screen
+     */
+    void set_bound_radius(float radius) {
+        bound_radius = radius;
+    }
+
+    /**
+     * Radius of the fountain in world units, around the origin it is drawn at
+     */
+    float get_draw_radius() const {
+        return bound_radius * scale_factor;
+    }
+
+    /**
+     * Share of the emitters' rates spent for the current view, 1 is full
+     */
+    float get_detail() const {
+        return detail;
+    }
+
     /**
      * Advances the particle fountain by the specified amount of time.
+     * The biggest footprint drawn since the last call sets how many
+     * particles the emitters spawn; with nothing drawn it stays as is.
      */
     void update(float dt) {
+        if (view_pixels >= 0) {
+            const float wanted = view_pixels / FULL_DETAIL_PIXELS;
+            detail = (wanted < MIN_DETAIL) ? MIN_DETAIL : ((wanted > 1.0f) ? 1.0f : wanted);
+            view_pixels = -1.0f;
+        }
         while (dt > 0) {
             if (time_until_next_step < dt) {
                 dt -= time_until_next_step;
@@ -88,154 +238,303 @@ public:
     }
 
     void update() {
-        float dt = 40 / 1000.0f;
-        while (dt > 0) {
-            if (time_until_next_step < dt) {
-                dt -= time_until_next_step;
-                step();
-                time_until_next_step = step_time;
-            } else {
-                time_until_next_step -= dt;
-                dt = 0;
-            }
+        update(DEFAULT_FRAME_TIME);
+    }
+
+    /**
+     * Stands in for draw() when the fountain is outside the view, it
+     * counts as drawn at no size at all
+     */
+    void skip_draw() {
+        view_pixels = max(view_pixels, 0.0f);
+    }
+
+    /**
+     * Texture and lighting draw() expects to be set up for it, drawn
+     * after everything opaque
+     */
+    util::render_state get_render_state() const {
+        if (texture_on) {
+            return util::render_state(texture_id, false, 1);
         }
+        return util::render_state(0, true, 1);
     }
 
+    /**
+     * Draw unless the fountain covers less than CULL_PIXELS on screen,
+     * skipping the depth sort when it is too small for order to show.
+     * The texture and lighting are left to get_render_state().
+     */
     void draw() {
-        vector<particle*> ps;
-        for(int i = 0; i < NUM_PARTICLES; i++) {
-            ps.push_back(particles + i);
+        const float pixels = measure_footprint();
+        view_pixels = max(view_pixels, pixels);
+        if (particles.size() == 0 || pixels < CULL_PIXELS) {
+            return;
         }
-        sort(ps.begin(), ps.end());
+        float mv[16];
+        glGetFloatv(GL_MODELVIEW_MATRIX, mv);
+        const bool changed = build_vertices(pixels >= SORT_PIXELS ? mv : NULL);
         glPushMatrix(); {
             glScalef(scale_factor, scale_factor, scale_factor);
-            if (texture_on) {
-                glEnable(GL_TEXTURE_2D);
-                glDisable(GL_LIGHTING);
-                glBindTexture(GL_TEXTURE_2D, texture_id);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            if (changed) {
+                stream.upload(&vertices[0], particles.size() * 4 * sizeof(particle_vertex));
             }
-            else {
-                glDisable(GL_TEXTURE_2D);
-            }
-            glBegin(GL_QUADS); {
-                float size;
-                for (unsigned int i = 0; i < ps.size(); i++) {
-                    particle* p = ps[i];
-                    glColor4f(p->color[0], p->color[1], p->color[2], (1 - p->time_alive / p->life_span));
-                    size = particle_size / 2;
-                    vector3<float> pos = adjust_particle_pos(p->position);
-                    glTexCoord2f(0, 0);
-                    glVertex3f(pos[0] - size, pos[1] - size, pos[2]);
-                    glTexCoord2f(0, 1);
-                    glVertex3f(pos[0] - size, pos[1] + size, pos[2]);
-                    glTexCoord2f(1, 1);
-                    glVertex3f(pos[0] + size, pos[1] + size, pos[2]);
-                    glTexCoord2f(1, 0);
-                    glVertex3f(pos[0] + size, pos[1] - size, pos[2]);
-                }
-            } glEnd();
+            stream.bind();
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glEnableClientState(GL_COLOR_ARRAY);
+            glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+            glVertexPointer(3, GL_FLOAT, sizeof(particle_vertex), stream.data(offsetof(particle_vertex, x)));
+            glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(particle_vertex), stream.data(offsetof(particle_vertex, r)));
+            glTexCoordPointer(2, GL_FLOAT, sizeof(particle_vertex), stream.data(offsetof(particle_vertex, u)));
+            glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(particles.size() * 4));
+            glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+            glDisableClientState(GL_COLOR_ARRAY);
+            glDisableClientState(GL_VERTEX_ARRAY);
+            stream.unbind();
         } glPopMatrix();
     }
 
+    /**
+     * Fill the interleaved vertex buffer with one quad per particle,
+     * back to front as seen through the modelview "mv", or in pool
+     * order when it is NULL. Returns false when nothing changed since
+     * last time.
+     */
+    bool build_vertices(const float *mv = NULL) {
+        const vector<unsigned> *order = NULL;
+        long version = 0;
+        if (mv != NULL) {
+            const depth_order &o = sort_by_depth(mv);
+            order = &o.sorter.get_index();
+            version = o.version;
+        } else {
+            tilt_particles();
+        }
+        if (built_steps == steps && built_order == version) {
+            return false;
+        }
+        const size_t n = particles.size();
+        const float size = particle_size / 2;
+        particle_vertex *out = &vertices[0];
+        for (size_t k = 0; k < n; k++, out += 4) {
+            const size_t i = (order != NULL) ? (*order)[k] : k;
+            const unsigned c = particles.rgba[i];
+            const float fade = 1 - particles.age[i] / particles.life[i];
+            const unsigned char alpha = static_cast<unsigned char>((fade < 0 ? 0 : fade) * 255.0f);
+            const vector3<float> &pos = tilted[i];
+            const float corner[4][2] = { { 0, 0 }, { 0, 1 }, { 1, 1 }, { 1, 0 } };
+            for (int v = 0; v < 4; v++) {
+                particle_vertex &pv = out[v];
+                pv.x = pos[0] + (corner[v][0] * 2 - 1) * size;
+                pv.y = pos[1] + (corner[v][1] * 2 - 1) * size;
+                pv.z = pos[2];
+                pv.r = c & 0xff;
+                pv.g = (c >> 8) & 0xff;
+                pv.b = (c >> 16) & 0xff;
+                pv.a = alpha;
+                pv.u = corner[v][0];
+                pv.v = corner[v][1];
+            }
+        }
+        built_steps = steps;
+        built_order = version;
+        return true;
+    }
+
     void toggle_texture_mode() {
         texture_on = !texture_on;
     }
 
 private:
     /**
-     * Returns the current color of particles produced by the fountain.
-     */
-    vector3<float> get_current_color() {
-        vector3<float> color;
-        if (color_time < 0.166667f) {
-            color = vector3<float>(1.0f, color_time * 6, 0.0f);
-        } else if (color_time < 0.333333f) {
-            color = vector3<float>((0.333333f - color_time) * 6, 1.0f, 0.0f);
-        } else if (color_time < 0.5f) {
-            color = vector3<float>(0.0f, 1.0f, (color_time - 0.333333f) * 6);
-        } else if (color_time < 0.666667f) {
-            color = vector3<float>(0.0f, (0.666667f - color_time) * 6, 1.0f);
-        } else if (color_time < 0.833333f) {
-            color = vector3<float>((color_time - 0.666667f) * 6, 0.0f, 1.0f);
-        } else {
-            color = vector3<float>(1.0f, 0.0f, (1.0f - color_time) * 6);
-        }
-        // make sure each of the color's components range from 0 to 1
-        for(int i = 0; i < 3; i++) {
-            if (color[i] < 0) {
-                color[i] = 0;
-            } else if (color[i] > 1) {
-                color[i] = 1;
-            }
+     * Radius in pixels the fountain covers with the current modelview,
+     * projection and viewport, 0 when it is entirely behind the camera
+     */
+    float measure_footprint() const {
+        return util::lod::projected_radius(get_draw_radius());
+    }
+
+    /**
+     * Tilt every particle. Nothing moves between simulation steps, so
+     * frames drawn in between reuse the last result.
+     */
+    void tilt_particles() {
+        const size_t n = particles.size();
+        if (tilted_steps == steps || n == 0) {
+            return;
+        }
+        for (size_t i = 0; i < n; i++) {
+            tilted[i] = vector3<float>(particles.px[i], particles.py[i], particles.pz[i]);
+        }
+        math3d::rotate(particle_tilt(), &tilted[0], &tilted[0], n);
+        tilted_steps = steps;
+    }
+
+    /**
+     * Order the tilted particles back to front by their eye space depth
+     * under the modelview "mv". Each view keeps its own order until the
+     * next step or until its camera turns; only the third row of "mv"
+     * matters, moving the camera or the engine shifts every depth alike.
+     */
+    const depth_order &sort_by_depth(const float mv[16]) {
+        depth_order &o = orders[util::lod::current_view()];
+        const size_t n = particles.size();
+        const float axis[3] = { mv[2], mv[6], mv[10] };
+        if (n == 0 || (o.steps == steps && memcmp(o.axis, axis, sizeof(axis)) == 0)) {
+            return o;
+        }
+        tilt_particles();
+        const vector3<float> forward(axis[0], axis[1], axis[2]);
+        for (size_t i = 0; i < n; i++) {
+            depth[i] = tilted[i].dot(forward);
+        }
+        // eye z is negative in front of the camera, ascending is back to front
+        o.sorter.sort(&depth[0], n);
+        o.steps = steps;
+        memcpy(o.axis, axis, sizeof(axis));
+        o.version = ++orders_built;
+        return o;
+    }
+
+    /**
+     * One job per chunk of the largest pool, each checks whether its
+     * chunk falls inside the range of the current pass
+     */
+    void setup_chunk_jobs() {
+        const size_t chunks = (particles.capacity() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        chunk_expired.assign(chunks, 0);
+        chunk_jobs.clear();
+        for (size_t k = 0; k < chunks; k++) {
+            chunk_jobs.add([this, k] { run_chunk(k); });
         }
-        return color;
     }
 
     /**
-     * Returns the average velocity of particles produced by the fountain.
+     * Run "pass" over particles [begin, end) in chunks of CHUNK_SIZE
      */
-    vector3<float> get_current_velocity() {
-        return vector3<float>(2 * cos(angle), 2.0f, 2 * sin(angle));
+    void run_chunks(chunk_pass pass, size_t begin, size_t end) {
+        if (begin >= end) {
+            return;
+        }
+        this->pass = pass;
+        pass_begin = begin;
+        pass_end = end;
+        const size_t chunks = (end - begin + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        if (chunks == 1 || jobs == NULL || jobs->get_workers() == 0) {
+            for (size_t k = 0; k < chunks; k++) {
+                run_chunk(k);
+            }
+        } else {
+            jobs->run(chunk_jobs);
+        }
+    }
+
+    void run_chunk(size_t k) {
+        const size_t begin = pass_begin + k * CHUNK_SIZE;
+        if (begin >= pass_end) {
+            return;
+        }
+        const size_t end = min(begin + CHUNK_SIZE, pass_end);
+        if (pass == STEP_PASS) {
+            chunk_expired[k] = step_particles(particles, begin, end, step_time);
+        } else {
+            // every (step, chunk) pair gets its own stream
+            util::philox rng(seed, (static_cast<uint64_t>(steps) << 32) | k);
+            for (size_t i = begin; i < end; i++) {
+                spawn_particle(i, rng);
+            }
+        }
     }
 
     /**
-     * Alters p to be a particle newly produced by the fountain.
+     * Fills slot i with a new particle for the emitter already stored
+     * in particles.emitter[i]
      */
-    void create_particle(particle *p) {
-        p->position = vector3<float>(0.0f, 0.0f, 0.0f);
-        p->velocity = get_current_velocity() +
-                vector3<float>(
-                        0.5f * random_float() - 0.25f,
-                        0.5f * random_float() - 0.25f,
-                        0.5f * random_float() - 0.25f);
-        p->color = get_current_color();
-        p->time_alive = 0;
-        p->life_span = random_float() + 1;
+    void spawn_particle(size_t i, util::philox &rng) {
+        const particle_emitter &em = emitters[particles.emitter[i]];
+        const vector3<float> &o = em.settings.origin;
+        const float u = rng.next_float();
+        const float v1 = rng.next_float();
+        const float w = rng.next_float();
+        const vector3<float> v = em.get_velocity(u, v1, w);
+        const vector3<float> c = em.get_color();
+        particles.px[i] = o[0], particles.py[i] = o[1], particles.pz[i] = o[2];
+        particles.vx[i] = v[0], particles.vy[i] = v[1], particles.vz[i] = v[2];
+        particles.rgba[i] = particle_buffer::pack_color(c[0], c[1], c[2]);
+        particles.age[i] = 0;
+        particles.life[i] = em.get_life(rng.next_float());
+        particles.gravity[i] = em.settings.gravity;
     }
 
     /**
-     * Advances the particle fountain by step_time seconds.
+     * Advances every live particle by step_time seconds, drops the
+     * expired ones and lets each emitter spawn what it is owed.
+     * Stepping and filling new particles run in chunks on the workers,
+     * removal and handing out slots stay serial so the order of the
+     * pool never depends on the threads.
      */
     void step() {
-        color_time += step_time / 10;
-        while (color_time >= 1) {
-            color_time -= 1;
-        }
-        angle += 0.5f * step_time;
-        while (angle > 2 * util::constants::PI) {
-            angle -= 2 * util::constants::PI;
-        }
-        for (int i = 0; i < NUM_PARTICLES; i++) {
-            particle* p = particles + i;
-            p->position += p->velocity * step_time;
-            p->velocity += vector3<float>(0.0f, -gravity * step_time, 0.0f);
-            p->time_alive += step_time;
-            if (p->time_alive > p->life_span) {
-                create_particle(p);
+        ++steps;
+        const size_t live = particles.size();
+        run_chunks(STEP_PASS, 0, live);
+        size_t expired = 0;
+        for (size_t k = 0; k * CHUNK_SIZE < live; k++) {
+            expired += chunk_expired[k];
+        }
+        if (expired > 0) {
+            remove_expired(particles);
+        }
+        const size_t first = particles.size();
+        for (size_t e = 0; e < emitters.size(); e++) {
+            for (int due = emitters[e].advance(step_time, detail); due > 0 && !particles.full(); due--) {
+                particles.emitter[particles.spawn()] = static_cast<int>(e);
             }
         }
+        run_chunks(SPAWN_PASS, first, particles.size());
     }
 
 private:
     unsigned texture_id;
     bool texture_on;
     float step_time;
-    float gravity;
     float particle_size;
     float scale_factor;
     // the amount of time until the next call to step().
     float time_until_next_step;
 
-    // the color of particles that the fountain is currently shooting.  0
-    // indicates red, and when it reaches 1, it starts over at red again.  It
-    // always lies between 0 and 1.
-    float color_time;
-
-    // the angle at which the fountain is shooting particles, in radians.
-    float angle;
-    particle particles[NUM_PARTICLES];
+    vector<particle_emitter> emitters;
+    // live particles of every emitter, packed at the front
+    particle_buffer particles;
+    // particle positions after particle_tilt()
+    vector<vector3<float> > tilted;
+    // eye space depth of every particle, and the order per view
+    vector<float> depth;
+    depth_order orders[util::lod::MAX_VIEWS];
+    // step() calls so far, the count when the tilt was last built and
+    // the orders built so far
+    long steps;
+    long tilted_steps;
+    long orders_built;
+    // one quad per particle, rebuilt after each step and streamed to GL
+    vector<particle_vertex> vertices;
+    vertex_stream stream;
+    // step and order version the vertices were built for
+    long built_steps;
+    long built_order;
+    // share of the emitters' rates spent, and the biggest screen radius
+    // drawn since update() last looked, -1 when nothing was drawn
+    float detail;
+    float view_pixels;
+    float bound_radius;
+    // workers for the chunks, one job per chunk and its expired count
+    util::job_system *jobs;
+    util::job_graph chunk_jobs;
+    vector<size_t> chunk_expired;
+    // what run_chunk() does and over which particles
+    chunk_pass pass;
+    size_t pass_begin;
+    size_t pass_end;
+    uint64_t seed;
 };
 
 #endif
\ No newline at end of file
@@ -6,33 +6,49 @@
 #include <algorithm>
 #include <cstdlib>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "object3d.h"
 #include "colors.h"
 #include "moon.h"
 #include "movable.h"
 #include "collidable.h"
+#include "orbit_store.h"
+#include "sphere_mesh.h"
+#include "screen_lod.h"
+#include "frustum.h"
+#include "render_queue.h"
 
 using namespace std;
 using namespace colors;
 
 class planet : public object3d, public movable, public drawable {
 
+public:
+    /* sphere tessellations from up close to a few pixels wide */
+    static const int LOD_COUNT = 4;
+
+    static const util::lod_level *get_lod_levels() {
+        static const util::lod_level levels[LOD_COUNT] = {
+            { 200, 40, 160.0f },
+            { 96, 24, 48.0f },
+            { 48, 16, 12.0f },
+            { 16, 8, 0.0f }
+        };
+        return levels;
+    }
+
 public:
     planet(const string &name = "planet", float radius = 1.0f, float degree = 1.0f, float p[3] = NULL, const color_name &c = green, unsigned t_id = 0):
     object3d(name, radius, false, vector3<float>(p[0], p[1], p[2]), vector3<float>(0, 1, 0)),
     radius(radius),
     degree(degree),
-    color(c) {
+    color(c),
+    orbits(NULL),
+    orbit_index(-1),
+    lod(get_lod_levels(), LOD_COUNT) {
 
         texture_id = t_id;
-        sphere = gluNewQuadric();
-        gluQuadricDrawStyle(sphere, GLU_FILL);
-        gluQuadricTexture(sphere, GL_TRUE);
-        gluQuadricNormals(sphere, GLU_SMOOTH);
 
         for (int i = 0; i < 3; ++i) {
             position[i] = p[i];
@@ -52,19 +68,20 @@ public:
         moons.push_back(m);
     }
 
-    vector<moon *> get_moons() const {
+    const vector<moon *> &get_moons() const {
         return moons;
     }
 
     void draw() {
         glPushMatrix();
         {
-            // save it for moons
-            glGetFloatv(GL_MODELVIEW_MATRIX, camera_view);
             // update
-            glMultMatrixf(OM);
+            glMultMatrixf(RM);
             // actual rendering
+            glEnable(GL_TEXTURE_2D);
+            glBindTexture(GL_TEXTURE_2D, texture_id);
             draw_itself();
+            glDisable(GL_TEXTURE_2D);
             // draw axis or bounding sphere
             object3d::draw();
             // draw all moons
@@ -73,17 +90,47 @@ public:
         glPopMatrix();
     }
 
+    /**
+     * Queue what "view" can see: the planet when its own sphere is
+     * in, then each moon tested on its own. Moons that are plain
+     * spheres go to "instances", the others to "queue".
+     */
+    void submit(util::render_queue &queue, util::instance_renderer &instances, const util::frustum &view) {
+        if (view.intersects(get_render_position(), bounding_sphere_radius)) {
+            queue.submit(util::render_state(texture_id), RM, [this]() {
+                draw_itself();
+                object3d::draw();
+            });
+        }
+        const util::matrix4 frame(RM);
+        for_each(moons.begin(), moons.end(), [&](moon *m) {
+            if (view.intersects(to_world(m->get_render_position()), m->get_enclosing_radius())) {
+                if (!m->submit(instances, frame)) {
+                    queue.submit(util::render_state(), RM, [m]() { m->draw(); });
+                }
+            }
+        });
+    }
+
+    /**
+     * Radius around the planet's center that holds it and all its moons
+     */
+    float get_system_radius() const {
+        float r = bounding_sphere_radius;
+        for_each(moons.begin(), moons.end(), [&](moon *m) {
+            r = max(r, m->get_render_position().length() + m->get_enclosing_radius());
+        });
+        return r;
+    }
+
+    /**
+     * The textured sphere, with the planet's texture already bound
+     */
     void draw_itself() {
         glColor3fv(get_color(color));
-        glEnable(GL_TEXTURE_2D);
-        {
-            glBindTexture(GL_TEXTURE_2D, texture_id);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            gluSphere(sphere, radius, 200, 40);
-            object3d::draw();
-        }
-        glDisable(GL_TEXTURE_2D);
+        const util::lod_level &level = lod.select_for_radius(radius);
+        util::sphere_cache::get(level.slices, level.stacks, true).draw(radius);
+        object3d::draw();
     }
 
     void draw_children() {
@@ -100,14 +147,33 @@ public:
     }
 
     void update() {
-        yaw += degree;
-        if (yaw >= 360.0f) {
-            yaw = 0.0f;
+        if (orbits != NULL) {
+            // OM was already advanced by orbit_store::update()
+            yaw = orbits->get_angle(orbit_index);
+        } else {
+            yaw += degree;
+            if (yaw >= 360.0f) {
+                yaw = 0.0f;
+            }
+            object3d::update_internal();
         }
-        object3d::update_internal();
         update_children();
     }
 
+    /**
+     * Hand the orbit over to a batched store, OM becomes a view of
+     * the store's local transform for this planet
+     */
+    void attach(util::orbit_store *store, int index) {
+        orbits = store;
+        orbit_index = index;
+        bind_orientation(store->get_local(index));
+    }
+
+    float get_degree() const {
+        return degree;
+    }
+
     void toggle_moons_debug_on() {
         for_each(moons.begin(), moons.end(), [this](moon *m) {
             m->set_debug_on(this->is_debug_on());
@@ -120,14 +186,26 @@ public:
         });
     }
 
+private:
+    /**
+     * A point of the planet's drawing frame in world space
+     */
+    vector3<float> to_world(const vector3<float> &p) const {
+        return vector3<float>(
+            RM[0] * p[0] + RM[4] * p[1] + RM[8] * p[2] + RM[12],
+            RM[1] * p[0] + RM[5] * p[1] + RM[9] * p[2] + RM[13],
+            RM[2] * p[0] + RM[6] * p[1] + RM[10] * p[2] + RM[14]);
+    }
+
 private:
     float radius;
     float degree;
     color_name color;
     vector<moon *> moons;
     unsigned texture_id;
-    GLUquadricObj *sphere;
-    float camera_view[16];
+    util::orbit_store *orbits;
+    int orbit_index;
+    util::lod_selector lod;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef __SOLAR_SYSTEM_RADIX_SORT_H
+#define __SOLAR_SYSTEM_RADIX_SORT_H
+
+#include <vector>
+#include <cstring>
+#include <cstddef>
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Stable LSD radix sort of float keys, producing an index order
+	 * instead of moving the data. Four 8-bit passes over 32-bit keys,
+	 * O(n) with no comparisons. All buffers are kept between calls so
+	 * sorting every frame allocates nothing once warmed up.
+	 */
+	class radix_sorter {
+	public:
+		/**
+		 * Fill the index buffer with 0..n-1 ordered by ascending keys[i],
+		 * equal keys keep their original order
+		 */
+		const vector<unsigned> &sort(const float *keys, size_t n) {
+			bits.resize(n);
+			bits_scratch.resize(n);
+			index.resize(n);
+			index_scratch.resize(n);
+			for (size_t i = 0; i < n; ++i) {
+				bits[i] = to_ordered(keys[i]);
+				index[i] = static_cast<unsigned>(i);
+			}
+			for (int shift = 0; shift < 32; shift += 8) {
+				size_t count[257];
+				memset(count, 0, sizeof(count));
+				for (size_t i = 0; i < n; ++i) {
+					++count[((bits[i] >> shift) & 0xff) + 1];
+				}
+				if (count[((bits.empty() ? 0 : bits[0]) >> shift & 0xff) + 1] == n) {
+					// every key shares this byte, the pass would not move anything
+					continue;
+				}
+				for (int b = 0; b < 256; ++b) {
+					count[b + 1] += count[b];
+				}
+				for (size_t i = 0; i < n; ++i) {
+					const size_t to = count[(bits[i] >> shift) & 0xff]++;
+					bits_scratch[to] = bits[i];
+					index_scratch[to] = index[i];
+				}
+				bits.swap(bits_scratch);
+				index.swap(index_scratch);
+			}
+			return index;
+		}
+
+		const vector<unsigned> &get_index() const {
+			return index;
+		}
+
+	private:
+		/**
+		 * Map a float to an unsigned with the same ordering: flip every
+		 * bit of negatives, only the sign bit of positives
+		 */
+		static unsigned to_ordered(float f) {
+			unsigned u;
+			memcpy(&u, &f, sizeof(u));
+			return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+		}
+
+	private:
+		vector<unsigned> bits;
+		vector<unsigned> bits_scratch;
+		vector<unsigned> index;
+		vector<unsigned> index_scratch;
+	};
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef __SOLAR_SYSTEM_RANDOM_H
+#define __SOLAR_SYSTEM_RANDOM_H
+
+#include <stdint.h>
+
+namespace util {
+	/**
+	 * Philox4x32-10 counter-based generator (Salmon et al., "Parallel
+	 * random numbers: as easy as 1, 2, 3"). The output is a pure function
+	 * of (key, stream, position), so any number of independent streams
+	 * can be handed out without sharing state, and the same stream gives
+	 * the same numbers on any thread in any order.
+	 */
+	class philox {
+	public:
+		philox(uint64_t key, uint64_t stream):
+			k0(static_cast<uint32_t>(key)),
+			k1(static_cast<uint32_t>(key >> 32)),
+			c2(static_cast<uint32_t>(stream)),
+			c3(static_cast<uint32_t>(stream >> 32)),
+			block(0),
+			used(4) {
+		}
+
+		uint32_t next_uint() {
+			if (used == 4) {
+				generate();
+				used = 0;
+			}
+			return out[used++];
+		}
+
+		/**
+		 * Uniform in [0, 1)
+		 */
+		float next_float() {
+			return (next_uint() >> 8) * (1.0f / 16777216.0f);
+		}
+
+	private:
+		static uint32_t mulhilo(uint32_t a, uint32_t b, uint32_t &hi) {
+			const uint64_t p = static_cast<uint64_t>(a) * b;
+			hi = static_cast<uint32_t>(p >> 32);
+			return static_cast<uint32_t>(p);
+		}
+
+		void generate() {
+			uint32_t x0 = static_cast<uint32_t>(block);
+			uint32_t x1 = static_cast<uint32_t>(block >> 32);
+			uint32_t x2 = c2, x3 = c3;
+			uint32_t key0 = k0, key1 = k1;
+			for (int round = 0; round < 10; ++round) {
+				uint32_t hi0, hi1;
+				const uint32_t lo0 = mulhilo(0xD2511F53u, x0, hi0);
+				const uint32_t lo1 = mulhilo(0xCD9E8D57u, x2, hi1);
+				x0 = hi1 ^ x1 ^ key0;
+				x1 = lo1;
+				x2 = hi0 ^ x3 ^ key1;
+				x3 = lo0;
+				key0 += 0x9E3779B9u;
+				key1 += 0xBB67AE85u;
+			}
+			out[0] = x0, out[1] = x1, out[2] = x2, out[3] = x3;
+			++block;
+		}
+
+	private:
+		uint32_t k0, k1;	// key
+		uint32_t c2, c3;	// stream, the high half of the counter
+		uint64_t block;		// position in the stream, the low half
+		uint32_t out[4];
+		int used;			// words of out already handed out
+	};
+}
+
+#endif
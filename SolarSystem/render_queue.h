@@ -0,0 +1,117 @@
+#ifndef __SOLAR_SYSTEM_RENDER_QUEUE_H
+#define __SOLAR_SYSTEM_RENDER_QUEUE_H
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <stdint.h>
+
+#include "gl_platform.h"
+
+#include "matrix4.h"
+#include "gl_state.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * One frame's worth of draws, collected first and then run sorted
+	 * by the state they need, so each texture is bound and lighting is
+	 * switched once per frame instead of once per object.
+	 *
+	 * Within a layer, layer 0 items are grouped by lighting then
+	 * texture; later layers keep the order they were submitted in, for
+	 * things that blend over the rest.
+	 */
+	class render_queue {
+	public:
+		render_queue() {
+			items.reserve(64);
+			order.reserve(64);
+		}
+
+		/**
+		 * Start a frame under the camera on top of the modelview stack
+		 */
+		void begin() {
+			glGetFloatv(GL_MODELVIEW_MATRIX, view.get());
+			items.clear();
+		}
+
+		/**
+		 * Queue "draw" to run with "state" applied, under the camera
+		 * times "model". draw() may push and pop matrices and attributes
+		 * but must leave the texture and lighting alone.
+		 */
+		void submit(const render_state &state, const float model[16], const function<void()> &draw) {
+			items.push_back(item());
+			item &it = items.back();
+			it.state = state;
+			it.key = sort_key(state, items.size() - 1);
+			it.model = matrix4(model);
+			it.draw = draw;
+		}
+
+		/**
+		 * Same, for a draw() that applies its own transform
+		 */
+		void submit(const render_state &state, const function<void()> &draw) {
+			submit(state, matrix4().get(), draw);
+		}
+
+		/**
+		 * Run every queued draw in state order through "gl" and empty the
+		 * queue; the modelview is left at the camera
+		 */
+		void flush(gl_state &gl) {
+			order.resize(items.size());
+			for (size_t i = 0; i < items.size(); ++i) {
+				order[i] = i;
+			}
+			sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+				return items[a].key < items[b].key;
+			});
+			for (size_t k = 0; k < order.size(); ++k) {
+				item &it = items[order[k]];
+				gl.apply(it.state);
+				matrix4 mv(view);
+				mv.multiply(it.model);
+				glLoadMatrixf(mv.get());
+				it.draw();
+			}
+			glLoadMatrixf(view.get());
+			items.clear();
+		}
+
+		size_t size() const {
+			return items.size();
+		}
+
+	private:
+		struct item {
+			uint64_t key;
+			render_state state;
+			matrix4 model;
+			function<void()> draw;
+		};
+
+		/**
+		 * layer first; then lighting and texture in layer 0, the
+		 * submission index in the others
+		 */
+		static uint64_t sort_key(const render_state &s, size_t index) {
+			const uint64_t layer = static_cast<uint64_t>(s.layer & 0xff) << 56;
+			if (s.layer == 0) {
+				return layer | (static_cast<uint64_t>(s.lighting ? 1 : 0) << 48) | (static_cast<uint64_t>(s.texture) << 16) | (index & 0xffff);
+			}
+			return layer | index;
+		}
+
+	private:
+		matrix4 view;
+		vector<item> items;
+		vector<size_t> order;
+	};
+}
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef __SOLAR_SYSTEM_SCREEN_LOD_H
+#define __SOLAR_SYSTEM_SCREEN_LOD_H
+
+#include <cmath>
+#include <cfloat>
+
+#include "gl_platform.h"
+
+namespace util {
+	namespace lod {
+		/* views drawn with their own camera, the game and the top window */
+		const int MAX_VIEWS = 2;
+		/* a boundary has to be crossed by this share before the level changes */
+		const float HYSTERESIS = 0.2f;
+
+		/**
+		 * The view being drawn, each keeps its own levels so the two
+		 * windows do not flip each other's choice every frame
+		 */
+		inline int &current_view() {
+			static int view = 0;
+			return view;
+		}
+
+		inline void set_view(int view) {
+			current_view() = (view >= 0 && view < MAX_VIEWS) ? view : 0;
+		}
+
+		/**
+		 * Radius in pixels of a sphere of "radius" around the origin of
+		 * the modelview "mv", under the current projection and viewport.
+		 * 0 when it is entirely behind the camera, FLT_MAX when the
+		 * camera is inside it.
+		 */
+		inline float projected_radius(float radius, const float mv[16]) {
+			float proj[16];
+			GLint viewport[4];
+			glGetFloatv(GL_PROJECTION_MATRIX, proj);
+			glGetIntegerv(GL_VIEWPORT, viewport);
+			const float r = radius * sqrtf(mv[0] * mv[0] + mv[1] * mv[1] + mv[2] * mv[2]);
+			const float half_height = viewport[3] * 0.5f;
+			if (proj[11] == 0.0f) {
+				// orthographic, the size does not depend on the distance
+				return r * proj[5] * half_height;
+			}
+			const float distance = -mv[14];
+			if (distance <= -r) {
+				return 0.0f;
+			}
+			if (distance <= r) {
+				return FLT_MAX;
+			}
+			return r * proj[5] / distance * half_height;
+		}
+
+		/**
+		 * Same, around the origin of the current modelview
+		 */
+		inline float projected_radius(float radius) {
+			float mv[16];
+			glGetFloatv(GL_MODELVIEW_MATRIX, mv);
+			return projected_radius(radius, mv);
+		}
+	}
+
+	/**
+	 * One tessellation of a curved primitive and the projected radius in
+	 * pixels it is good for down to; the coarsest has 0
+	 */
+	struct lod_level {
+		int slices;
+		int stacks;
+		float min_pixels;
+	};
+
+	/**
+	 * Picks one of a few detail levels, finest first, from a projected
+	 * radius. Moving to another level needs the radius to clear the
+	 * boundary by lod::HYSTERESIS, so an object sitting on one does not
+	 * pop back and forth.
+	 */
+	class lod_selector {
+	public:
+		lod_selector(const lod_level *levels, int count):
+			levels(levels),
+			count(count) {
+			for (int v = 0; v < lod::MAX_VIEWS; ++v) {
+				current[v] = 0;
+			}
+		}
+
+		const lod_level &select(float pixels) {
+			int &k = current[lod::current_view()];
+			while (k > 0 && pixels > levels[k - 1].min_pixels * (1.0f + lod::HYSTERESIS)) {
+				--k;
+			}
+			while (k < count - 1 && pixels < levels[k].min_pixels * (1.0f - lod::HYSTERESIS)) {
+				++k;
+			}
+			return levels[k];
+		}
+
+		/**
+		 * Level for a sphere of "radius" around the current transform
+		 */
+		const lod_level &select_for_radius(float radius) {
+			return select(lod::projected_radius(radius));
+		}
+
+		int get_index() const {
+			return current[lod::current_view()];
+		}
+
+	private:
+		const lod_level *levels;
+		int count;
+		int current[lod::MAX_VIEWS];
+	};
+}
+
+#endif
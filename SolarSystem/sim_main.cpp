@@ -0,0 +1,154 @@
+//
+//  sim_main.cpp
+//  SolarSystem
+//
+//  Headless driver: builds the same galaxy as the game and advances
+//  it without GLUT or a GL context. Build with SOLAR_SYSTEM_HEADLESS.
+//
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <random>
+
+#include "galaxy.h"
+
+using namespace std;
+
+namespace simulation {
+    const char *texture_files[] = {
+        "suntexture.bmp",
+        "galaxy0.bmp", "galaxy1.bmp", "galaxy2.bmp", "galaxy3.bmp",
+        "galaxy4.bmp", "galaxy5.bmp", "galaxy6.bmp", "galaxy7.bmp",
+        "galaxy8.bmp", "galaxy9.bmp", "galaxy10.bmp",
+        "messi.bmp",
+        "circle.bmp"
+    };
+
+    /**
+     * galaxy only needs texture ids, never pixels, so every
+     * texture the game expects is mapped to id 0
+     */
+    unordered_map<string, unsigned> headless_textures() {
+        unordered_map<string, unsigned> hm;
+        for (unsigned i = 0; i < sizeof(texture_files)/sizeof(texture_files[0]); ++i) {
+            hm.insert(make_pair(string(texture_files[i]), 0u));
+        }
+        return hm;
+    }
+
+    void usage(const char *program) {
+        cout << "usage: " << program << " [-n ticks] [-g] [-t theta] [-b bodies] [-j workers]\n";
+        cout << "  -n ticks   number of galaxy::update() calls (default 10000)\n";
+        cout << "  -g         turn gravity on before running\n";
+        cout << "  -t theta   Barnes-Hut opening angle (default 0.5)\n";
+        cout << "  -b bodies  time the gravity field alone with this many random bodies\n";
+        cout << "  -j workers job threads besides the main one (default: cores - 1)\n";
+    }
+
+    /**
+     * Build a gravity field over n random bodies, query it at every body,
+     * and compare a sample of queries against the exact sum
+     */
+    int run_gravity(long n, float theta) {
+        mt19937 rng(1);
+        uniform_real_distribution<float> coordinate(-20000.0f, 20000.0f);
+        uniform_real_distribution<float> mass(1.0f, 1000.0f);
+        vector<vector3<float> > bodies;
+        bodies.reserve(n);
+        util::gravity_field field(theta), exact(0.0f);
+        field.reserve(n);
+        for (long i = 0; i < n; ++i) {
+            bodies.push_back(vector3<float>(coordinate(rng), coordinate(rng), coordinate(rng)));
+            float m = mass(rng);
+            field.add(bodies.back(), m);
+            exact.add(bodies.back(), m);
+        }
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        field.build();
+        chrono::steady_clock::time_point built = chrono::steady_clock::now();
+        float checksum = 0.0f;
+        for (long i = 0; i < n; ++i) {
+            checksum += field.acceleration_at(bodies[i]).get_x();
+        }
+        chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+        exact.build();
+        double worst = 0.0;
+        for (long i = 0; i < n && i < 100; ++i) {
+            vector3<float> a = exact.acceleration_at(bodies[i]);
+            vector3<float> b = field.acceleration_at(bodies[i]);
+            if (a.length() > 0) {
+                worst = max(worst, static_cast<double>((a - b).length() / a.length()));
+            }
+        }
+
+        double build_ms = chrono::duration<double, milli>(built - start).count();
+        double query_ms = chrono::duration<double, milli>(end - built).count();
+        cout << "bodies: " << n << " theta: " << theta << '\n';
+        cout << "build: " << build_ms << " ms\n";
+        cout << "queries: " << query_ms << " ms (" << (query_ms * 1e6) / n << " ns/body)\n";
+        cout << "max relative error: " << worst << " (checksum " << checksum << ")\n";
+        return 0;
+    }
+
+    int run(int argc, char **argv) {
+        long ticks = 10000;
+        bool gravity = false;
+        float theta = GRAVITY_THETA;
+        long bodies = 0;
+        long workers = -1;
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+                ticks = atol(argv[++i]);
+            } else if (strcmp(argv[i], "-g") == 0) {
+                gravity = true;
+            } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+                theta = static_cast<float>(atof(argv[++i]));
+            } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+                bodies = atol(argv[++i]);
+            } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+                workers = atol(argv[++i]);
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+
+        if (bodies > 0) {
+            return run_gravity(bodies, theta);
+        }
+
+        galaxy controller(headless_textures());
+        controller.get_gravity_field().set_theta(theta);
+        if (workers >= 0) {
+            controller.get_job_system().set_workers(static_cast<unsigned>(workers));
+        }
+        if (gravity) {
+            controller.on_keyboard('g', 0, 0);
+        }
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (long i = 0; i < ticks; ++i) {
+            controller.update();
+        }
+        chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+        double seconds = chrono::duration<double>(end - start).count();
+        cout << "ticks: " << ticks << " workers: " << controller.get_job_system().get_workers() << '\n';
+        cout << "elapsed: " << seconds << " s\n";
+        if (seconds > 0) {
+            cout << "ticks/second: " << ticks / seconds << '\n';
+            cout << "us/tick: " << (seconds * 1e6) / ticks << '\n';
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    return simulation::run(argc, argv);
+}
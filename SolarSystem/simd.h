@@ -0,0 +1,111 @@
+#ifndef __SOLAR_SYSTEM_SIMD_H
+#define __SOLAR_SYSTEM_SIMD_H
+
+#include <cmath>
+
+/**
+ * Minimal 4-wide float helpers for vector3<float> and the batch kernels
+ * in math3d. SSE on x86, NEON on ARM, plain arrays everywhere else.
+ * Define SOLAR_SYSTEM_NO_SIMD to force the plain version.
+ */
+#if !defined(SOLAR_SYSTEM_NO_SIMD) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define SOLAR_SYSTEM_SIMD_SSE 1
+#elif !defined(SOLAR_SYSTEM_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define SOLAR_SYSTEM_SIMD_NEON 1
+#endif
+
+namespace util {
+	namespace simd {
+#if defined(SOLAR_SYSTEM_SIMD_SSE)
+		typedef __m128 float4;
+
+		inline float4 set(float x, float y, float z, float w) {
+			return _mm_set_ps(w, z, y, x);
+		}
+
+		inline float4 splat(float s) {
+			return _mm_set1_ps(s);
+		}
+
+		inline float4 add(float4 a, float4 b) {
+			return _mm_add_ps(a, b);
+		}
+
+		inline float4 sub(float4 a, float4 b) {
+			return _mm_sub_ps(a, b);
+		}
+
+		inline float4 mul(float4 a, float4 b) {
+			return _mm_mul_ps(a, b);
+		}
+
+		inline float4 div(float4 a, float4 b) {
+			return _mm_div_ps(a, b);
+		}
+#elif defined(SOLAR_SYSTEM_SIMD_NEON)
+		typedef float32x4_t float4;
+
+		inline float4 set(float x, float y, float z, float w) {
+			const float v[4] = { x, y, z, w };
+			return vld1q_f32(v);
+		}
+
+		inline float4 splat(float s) {
+			return vdupq_n_f32(s);
+		}
+
+		inline float4 add(float4 a, float4 b) {
+			return vaddq_f32(a, b);
+		}
+
+		inline float4 sub(float4 a, float4 b) {
+			return vsubq_f32(a, b);
+		}
+
+		inline float4 mul(float4 a, float4 b) {
+			return vmulq_f32(a, b);
+		}
+
+		inline float4 div(float4 a, float4 b) {
+			// ARMv7 has no vector divide, go through the lanes
+			float x[4], y[4];
+			vst1q_f32(x, a);
+			vst1q_f32(y, b);
+			return set(x[0] / y[0], x[1] / y[1], x[2] / y[2], x[3] / y[3]);
+		}
+#else
+		struct float4 {
+			float v[4];
+		};
+
+		inline float4 set(float x, float y, float z, float w) {
+			float4 r = { { x, y, z, w } };
+			return r;
+		}
+
+		inline float4 splat(float s) {
+			return set(s, s, s, s);
+		}
+
+		inline float4 add(float4 a, float4 b) {
+			return set(a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]);
+		}
+
+		inline float4 sub(float4 a, float4 b) {
+			return set(a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]);
+		}
+
+		inline float4 mul(float4 a, float4 b) {
+			return set(a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]);
+		}
+
+		inline float4 div(float4 a, float4 b) {
+			return set(a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]);
+		}
+#endif
+	}
+}
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef __SOLAR_SYSTEM_SKYBOX_H
+#define __SOLAR_SYSTEM_SKYBOX_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+#include "gl_platform.h"
+
+#include "vertex_stream.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Background cube drawn around the camera. The 24 vertices are
+	 * built once and kept in a static vertex buffer (client arrays
+	 * without one); drawing moves the cube with the camera and writes
+	 * no depth, so it sits behind everything whatever the far plane.
+	 *
+	 * Holds several sets of six face textures, one of which is drawn;
+	 * a set made of one texture repeats it on every face.
+	 */
+	class skybox {
+	public:
+		enum face { POSITIVE_X, NEGATIVE_X, POSITIVE_Y, NEGATIVE_Y, POSITIVE_Z, NEGATIVE_Z, FACE_COUNT };
+
+		/* half side of the cube, anything between the near and far planes */
+		static constexpr float SIZE = 100.0f;
+
+		/**
+		 * File holding one face of a sky texture, "galaxy0.bmp" becomes
+		 * "galaxy0_px.bmp" for POSITIVE_X
+		 */
+		static string face_file(const string &name, int f) {
+			static const char *suffix[FACE_COUNT] = { "_px", "_nx", "_py", "_ny", "_pz", "_nz" };
+			const size_t dot = name.rfind('.');
+			if (dot == string::npos) {
+				return name + suffix[f];
+			}
+			return name.substr(0, dot) + suffix[f] + name.substr(dot);
+		}
+
+	public:
+		skybox() {
+			build();
+		}
+
+		/**
+		 * Add a set of face textures in face order, returns its index
+		 */
+		int add(const GLuint faces[FACE_COUNT]) {
+			for (int f = 0; f < FACE_COUNT; ++f) {
+				textures.push_back(faces[f]);
+			}
+			return static_cast<int>(size() - 1);
+		}
+
+		/**
+		 * Add a set with "texture" on all six faces
+		 */
+		int add(GLuint texture) {
+			GLuint faces[FACE_COUNT];
+			for (int f = 0; f < FACE_COUNT; ++f) {
+				faces[f] = texture;
+			}
+			return add(faces);
+		}
+
+		size_t size() const {
+			return textures.size() / FACE_COUNT;
+		}
+
+		/**
+		 * Draw set "index" around the camera of the current modelview.
+		 * Draw it first, it neither tests nor writes depth.
+		 */
+		void draw(int index) {
+			if (index < 0 || static_cast<size_t>(index) >= size()) {
+				return;
+			}
+			// the camera's rotation only, the cube moves along with it
+			float mv[16];
+			glGetFloatv(GL_MODELVIEW_MATRIX, mv);
+			mv[12] = mv[13] = mv[14] = 0.0f;
+			glPushMatrix();
+			glPushAttrib(GL_ENABLE_BIT | GL_DEPTH_BUFFER_BIT); {
+				glLoadMatrixf(mv);
+				glDisable(GL_LIGHTING);
+				glDisable(GL_DEPTH_TEST);
+				glDepthMask(GL_FALSE);
+				glEnable(GL_TEXTURE_2D);
+				const GLsizei bytes = static_cast<GLsizei>(5 * sizeof(float));
+				buffer.bind(&vertices[0], vertices.size() * sizeof(float));
+				glEnableClientState(GL_VERTEX_ARRAY);
+				glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+				glVertexPointer(3, GL_FLOAT, bytes, buffer.vertex_data(0));
+				glTexCoordPointer(2, GL_FLOAT, bytes, buffer.vertex_data(3 * sizeof(float)));
+				// faces sharing a texture go in one call
+				const GLuint *set = &textures[index * FACE_COUNT];
+				for (int f = 0; f < FACE_COUNT; ) {
+					int last = f + 1;
+					while (last < FACE_COUNT && set[last] == set[f]) {
+						++last;
+					}
+					glBindTexture(GL_TEXTURE_2D, set[f]);
+					glDrawArrays(GL_QUADS, f * 4, (last - f) * 4);
+					f = last;
+				}
+				glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+				glDisableClientState(GL_VERTEX_ARRAY);
+				buffer.unbind();
+				glDepthMask(GL_TRUE);
+			} glPopAttrib();
+			glPopMatrix();
+		}
+
+	private:
+		/**
+		 * Four corners per face in face order, x, y, z, s, t each, seen
+		 * from inside the cube
+		 */
+		void build() {
+			static const float corners[FACE_COUNT][4][3] = {
+				{ { 1, -1, -1 }, { 1, -1, 1 }, { 1, 1, 1 }, { 1, 1, -1 } },
+				{ { -1, -1, 1 }, { -1, -1, -1 }, { -1, 1, -1 }, { -1, 1, 1 } },
+				{ { -1, 1, 1 }, { -1, 1, -1 }, { 1, 1, -1 }, { 1, 1, 1 } },
+				{ { -1, -1, -1 }, { -1, -1, 1 }, { 1, -1, 1 }, { 1, -1, -1 } },
+				{ { 1, -1, 1 }, { -1, -1, 1 }, { -1, 1, 1 }, { 1, 1, 1 } },
+				{ { -1, -1, -1 }, { 1, -1, -1 }, { 1, 1, -1 }, { -1, 1, -1 } }
+			};
+			static const float st[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+			vertices.reserve(FACE_COUNT * 4 * 5);
+			for (int f = 0; f < FACE_COUNT; ++f) {
+				for (int v = 0; v < 4; ++v) {
+					for (int k = 0; k < 3; ++k) {
+						vertices.push_back(corners[f][v][k] * SIZE);
+					}
+					vertices.push_back(st[v][0]);
+					vertices.push_back(st[v][1]);
+				}
+			}
+		}
+
+	private:
+		vector<float> vertices;		// x, y, z, s, t
+		vector<GLuint> textures;	// FACE_COUNT per set
+		static_buffers buffer;
+	};
+}
+
+#endif
@@ -5,9 +5,7 @@
 #include <cstdlib>
 #include <string>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "object3d.h"
 #include "colors.h"
@@ -16,6 +14,8 @@
 #include "vector3.h"
 #include "missile.h"
 #include "torpedo.h"
+#include "explodable.h"
+#include "instance_batch.h"
 
 using namespace std;
 using namespace util;
@@ -23,7 +23,8 @@ using namespace util;
 class spaceship:	
 	public object3d,
 	public movable,
-	public drawable {
+	public drawable,
+	public explodable {
 
 public:
 	enum direction {
@@ -37,6 +38,9 @@ public:
 
 	static const int MAX_MISSILES = 20;
 
+	/* reach of the burst when the ship goes down */
+	static constexpr float EXPLOSION_RADIUS = 1000.0f;
+
 public:
 	spaceship() {
 		alive = true;
@@ -71,9 +75,8 @@ public:
 		alive = true;
 		explosion_count_down = 50;
 		bounding_sphere_radius = 130;
-		explosion_radius = 1000;
 		no_lives = 5;
-		list_id = 1;
+		model = NULL;
 		target = vector3<float>(0.0f, 0.0f, 0.0f);
 		torpe = NULL;
 		model_or_primitive = true;
@@ -90,16 +93,16 @@ public:
 	void draw() {
 		glPushMatrix(); {
 			// update
-			glMultMatrixf(OM);
+			glMultMatrixf(RM);
 			// actual drawing
 			if (alive) {
-				if (model_or_primitive) {
+				if (model_or_primitive && model != NULL) {
 					draw_model();
 				} else {
 					draw_spaceship();
 				}
 			} else {
-				draw_explosion();
+				draw_wreck();
 			}
 		}
         glPopMatrix();
@@ -107,6 +110,28 @@ public:
 		moving = false;
 	}
 	
+	/**
+	 * Queue the ship as a copy of its model when it is drawn as the
+	 * plain model; false when draw() has to be called instead
+	 */
+	bool submit(util::instance_renderer &instances) {
+		if (!alive || !model_or_primitive || model == NULL || bounding_sphere) {
+			return false;
+		}
+		instances.add(*model, util::matrix4(get_render_matrix()), get_color(colors::white));
+		// reset moving, as draw() does
+		moving = false;
+		return true;
+	}
+
+	/**
+	 * Mesh drawn for the ship, shared with the other ships; without
+	 * one the ship is drawn as its primitive
+	 */
+	void set_model(util::instanced_mesh *mesh) {
+		model = mesh;
+	}
+
 	/** 
 	 * Move the ship to a new location "destination" 
 	 */
@@ -153,6 +178,7 @@ public:
 			if (no_torpedo < MAX_MISSILES) {
 				if (torpe == NULL) {
 					torpe = new torpedo("torpedo", get_position(), get_position() + (get_forward() + 100), colors::red, torpedo_type::AIM_4_FALCON, 20, 1000);
+					torpe->set_explosions(get_explosions());
 					return torpe;
 				} else {
 					torpe->set_new_position(get_position());
@@ -243,6 +269,9 @@ public:
 	}
 
 	void destroy() {
+		if (alive) {
+			explode(get_position(), EXPLOSION_RADIUS, colors::red);
+		}
 		alive = false;
 	}
 
@@ -296,22 +325,21 @@ public:
 
 private:
 	void draw_model() {
-		glCallList(list_id);
+		model->bind();
+		model->draw_bound();
+		model->unbind();
 		if (bounding_sphere) {
 			glColor3fv(get_color(colors::white));
-			glutWireSphere(bounding_sphere_radius/100.0, 40, 17);
+			glutWireSphere(bounding_sphere_radius, 40, 17);
 		}
 	}
 
-	void draw_explosion() {
-		if (explosion_radius > 0) {
-			glColor3fv(get_color(colors::red));
-			glutWireSphere(explosion_radius, 30, 17);
-			explosion_radius -= 50;
-		} else {
-			glColor3fv(get_color(colors::white));
-			glutWireSphere(50, 30, 17);
-		}
+	/**
+	 * What is left of the ship, its explosion burst plays on top
+	 */
+	void draw_wreck() {
+		glColor3fv(get_color(colors::white));
+		glutWireSphere(50, 30, 17);
 	}
 
 	void draw_spaceship() {
@@ -351,9 +379,6 @@ private:
 	color_name base_color;
 	color_name top_color;
 
-	/* radius of circle when explosion occur, lazy approach! */
-	int explosion_radius;
-	
 	/* the number of times to draw explosion effect */
 	int explosion_count_down;
 
@@ -366,8 +391,8 @@ private:
 	/* alive flag */
 	bool alive;
 
-	/* id list for model loading from .tri file */
-	int list_id;
+	/* model loaded from a .mesh file, not owned */
+	util::instanced_mesh *model;
 
 	/* number of lives for ship */
 	int no_lives;
@@ -1,2219 +0,0 @@
-#ifndef SPECIAL_MODEL_H
-#define SPECIAL_MODEL_H
-
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
-
-namespace special_model {
-    void generate_spaceship_model(int list_id, float scale) {
-        glEnable(GL_NORMALIZE);
-        glNewList(list_id, GL_COMPILE);
-        glScalef(scale, scale, scale);
-        glBegin(GL_TRIANGLES);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9967, -0.0809);
-        glVertex3f(0.0000, -0.0550, 0.8579);
-        glVertex3f(0.0484, -0.0900, 1.2889);
-        glVertex3f(0.0000, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9967, -0.0809);
-        glVertex3f(0.0484, -0.0900, 1.2889);
-        glVertex3f(0.0000, -0.0550, 0.8579);
-        glVertex3f(0.0723, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0000, -0.0450, 0.7860);
-        glVertex3f(0.0723, -0.0550, 0.8579);
-        glVertex3f(0.0000, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0723, -0.0550, 0.8579);
-        glVertex3f(0.0000, -0.0450, 0.7860);
-        glVertex3f(0.0804, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9967, -0.0809);
-        glVertex3f(0.0723, -0.0550, 0.8579);
-        glVertex3f(0.0580, -0.0900, 1.2889);
-        glVertex3f(0.0484, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9967, -0.0809);
-        glVertex3f(0.0580, -0.0900, 1.2889);
-        glVertex3f(0.0723, -0.0550, 0.8579);
-        glVertex3f(0.0862, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0804, -0.0450, 0.7860);
-        glVertex3f(0.0862, -0.0550, 0.8579);
-        glVertex3f(0.0723, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0862, -0.0550, 0.8579);
-        glVertex3f(0.0804, -0.0450, 0.7860);
-        glVertex3f(0.0958, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9979, 0.0000, 0.0653);
-        glVertex3f(0.0580, -0.0200, 1.2889);
-        glVertex3f(0.0862, -0.0550, 0.8579);
-        glVertex3f(0.0862, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9979, 0.0000, 0.0653);
-        glVertex3f(0.0862, -0.0550, 0.8579);
-        glVertex3f(0.0580, -0.0200, 1.2889);
-        glVertex3f(0.0580, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9911, 0.0000, 0.1328);
-        glVertex3f(0.0862, 0.0150, 0.8579);
-        glVertex3f(0.0958, -0.0450, 0.7860);
-        glVertex3f(0.0958, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9911, 0.0000, 0.1328);
-        glVertex3f(0.0958, -0.0450, 0.7860);
-        glVertex3f(0.0862, 0.0150, 0.8579);
-        glVertex3f(0.0862, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9967, 0.0809);
-        glVertex3f(0.0862, 0.0150, 0.8579);
-        glVertex3f(0.0484, -0.0200, 1.2889);
-        glVertex3f(0.0580, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9967, 0.0809);
-        glVertex3f(0.0484, -0.0200, 1.2889);
-        glVertex3f(0.0862, 0.0150, 0.8579);
-        glVertex3f(0.0723, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0958, 0.0250, 0.7860);
-        glVertex3f(0.0723, 0.0150, 0.8579);
-        glVertex3f(0.0862, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0723, 0.0150, 0.8579);
-        glVertex3f(0.0958, 0.0250, 0.7860);
-        glVertex3f(0.0804, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0000, -0.0350, 0.7142);
-        glVertex3f(0.0804, -0.0450, 0.7860);
-        glVertex3f(0.0000, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0804, -0.0450, 0.7860);
-        glVertex3f(0.0000, -0.0350, 0.7142);
-        glVertex3f(0.0933, -0.0350, 0.7142);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0933, -0.0350, 0.7142);
-        glVertex3f(0.0958, -0.0450, 0.7860);
-        glVertex3f(0.0804, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0958, -0.0450, 0.7860);
-        glVertex3f(0.0933, -0.0350, 0.7142);
-        glVertex3f(0.1111, -0.0350, 0.7142);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9780, 0.0000, 0.2085);
-        glVertex3f(0.0958, 0.0250, 0.7860);
-        glVertex3f(0.1111, -0.0350, 0.7142);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9780, 0.0000, 0.2085);
-        glVertex3f(0.1111, -0.0350, 0.7142);
-        glVertex3f(0.0958, 0.0250, 0.7860);
-        glVertex3f(0.0958, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glVertex3f(0.0804, 0.0250, 0.7860);
-        glVertex3f(0.0958, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0804, 0.0250, 0.7860);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glVertex3f(0.0933, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(0.1183, -0.0450, 0.2282);
-        glVertex3f(0.1111, -0.0350, 0.7142);
-        glVertex3f(0.0933, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(0.1111, -0.0350, 0.7142);
-        glVertex3f(0.1183, -0.0450, 0.2282);
-        glVertex3f(0.1414, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(0.0000, -0.0450, 0.2282);
-        glVertex3f(0.0933, -0.0350, 0.7142);
-        glVertex3f(0.0000, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(0.0933, -0.0350, 0.7142);
-        glVertex3f(0.0000, -0.0450, 0.2282);
-        glVertex3f(0.1183, -0.0450, 0.2282);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9992, 0.0406);
-        glVertex3f(0.0580, -0.0200, 1.2889);
-        glVertex3f(0.0417, -0.0300, 1.5353);
-        glVertex3f(0.0500, -0.0300, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9992, 0.0406);
-        glVertex3f(0.0417, -0.0300, 1.5353);
-        glVertex3f(0.0580, -0.0200, 1.2889);
-        glVertex3f(0.0484, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9995, 0.0000, 0.0323);
-        glVertex3f(0.0500, -0.0300, 1.5353);
-        glVertex3f(0.0580, -0.0900, 1.2889);
-        glVertex3f(0.0580, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9995, 0.0000, 0.0323);
-        glVertex3f(0.0580, -0.0900, 1.2889);
-        glVertex3f(0.0500, -0.0300, 1.5353);
-        glVertex3f(0.0500, -0.1000, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9992, -0.0406);
-        glVertex3f(0.0484, -0.0900, 1.2889);
-        glVertex3f(0.0500, -0.1000, 1.5353);
-        glVertex3f(0.0417, -0.1000, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9992, -0.0406);
-        glVertex3f(0.0500, -0.1000, 1.5353);
-        glVertex3f(0.0484, -0.0900, 1.2889);
-        glVertex3f(0.0580, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9992, -0.0406);
-        glVertex3f(0.0000, -0.0900, 1.2889);
-        glVertex3f(0.0417, -0.1000, 1.5353);
-        glVertex3f(0.0000, -0.1000, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9992, -0.0406);
-        glVertex3f(0.0417, -0.1000, 1.5353);
-        glVertex3f(0.0000, -0.0900, 1.2889);
-        glVertex3f(0.0484, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9967, 0.0809);
-        glVertex3f(0.0723, 0.0150, 0.8579);
-        glVertex3f(0.0000, -0.0200, 1.2889);
-        glVertex3f(0.0484, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9967, 0.0809);
-        glVertex3f(0.0000, -0.0200, 1.2889);
-        glVertex3f(0.0723, 0.0150, 0.8579);
-        glVertex3f(0.0000, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0804, 0.0250, 0.7860);
-        glVertex3f(0.0000, 0.0150, 0.8579);
-        glVertex3f(0.0723, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0000, 0.0150, 0.8579);
-        glVertex3f(0.0804, 0.0250, 0.7860);
-        glVertex3f(0.0000, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0933, 0.0350, 0.7142);
-        glVertex3f(0.0000, 0.0250, 0.7860);
-        glVertex3f(0.0804, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0000, 0.0250, 0.7860);
-        glVertex3f(0.0933, 0.0350, 0.7142);
-        glVertex3f(0.0000, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9867, 0.1624);
-        glVertex3f(0.1183, 0.1150, 0.2282);
-        glVertex3f(0.0000, 0.0350, 0.7142);
-        glVertex3f(0.0933, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9867, 0.1624);
-        glVertex3f(0.0000, 0.0350, 0.7142);
-        glVertex3f(0.1183, 0.1150, 0.2282);
-        glVertex3f(0.0000, 0.1150, 0.2282);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9992, 0.0406);
-        glVertex3f(0.0484, -0.0200, 1.2889);
-        glVertex3f(0.0000, -0.0300, 1.5353);
-        glVertex3f(0.0417, -0.0300, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9992, 0.0406);
-        glVertex3f(0.0000, -0.0300, 1.5353);
-        glVertex3f(0.0484, -0.0200, 1.2889);
-        glVertex3f(0.0000, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9967, -0.0809);
-        glVertex3f(-0.0723, -0.0550, 0.8579);
-        glVertex3f(0.0000, -0.0900, 1.2889);
-        glVertex3f(-0.0484, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9967, -0.0809);
-        glVertex3f(0.0000, -0.0900, 1.2889);
-        glVertex3f(-0.0723, -0.0550, 0.8579);
-        glVertex3f(0.0000, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(-0.0804, -0.0450, 0.7860);
-        glVertex3f(0.0000, -0.0550, 0.8579);
-        glVertex3f(-0.0723, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0000, -0.0550, 0.8579);
-        glVertex3f(-0.0804, -0.0450, 0.7860);
-        glVertex3f(0.0000, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9967, -0.0809);
-        glVertex3f(-0.0862, -0.0550, 0.8579);
-        glVertex3f(-0.0484, -0.0900, 1.2889);
-        glVertex3f(-0.0580, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9967, -0.0809);
-        glVertex3f(-0.0484, -0.0900, 1.2889);
-        glVertex3f(-0.0862, -0.0550, 0.8579);
-        glVertex3f(-0.0723, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(-0.0958, -0.0450, 0.7860);
-        glVertex3f(-0.0723, -0.0550, 0.8579);
-        glVertex3f(-0.0862, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(-0.0723, -0.0550, 0.8579);
-        glVertex3f(-0.0958, -0.0450, 0.7860);
-        glVertex3f(-0.0804, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9979, 0.0000, 0.0653);
-        glVertex3f(-0.0862, -0.0550, 0.8579);
-        glVertex3f(-0.0580, -0.0200, 1.2889);
-        glVertex3f(-0.0862, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9979, 0.0000, 0.0653);
-        glVertex3f(-0.0580, -0.0200, 1.2889);
-        glVertex3f(-0.0862, -0.0550, 0.8579);
-        glVertex3f(-0.0580, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9911, 0.0000, 0.1328);
-        glVertex3f(-0.0958, -0.0450, 0.7860);
-        glVertex3f(-0.0862, 0.0150, 0.8579);
-        glVertex3f(-0.0958, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9911, 0.0000, 0.1328);
-        glVertex3f(-0.0862, 0.0150, 0.8579);
-        glVertex3f(-0.0958, -0.0450, 0.7860);
-        glVertex3f(-0.0862, -0.0550, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9967, 0.0809);
-        glVertex3f(-0.0723, 0.0150, 0.8579);
-        glVertex3f(-0.0580, -0.0200, 1.2889);
-        glVertex3f(-0.0484, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9967, 0.0809);
-        glVertex3f(-0.0580, -0.0200, 1.2889);
-        glVertex3f(-0.0723, 0.0150, 0.8579);
-        glVertex3f(-0.0862, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(-0.0804, 0.0250, 0.7860);
-        glVertex3f(-0.0862, 0.0150, 0.8579);
-        glVertex3f(-0.0723, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(-0.0862, 0.0150, 0.8579);
-        glVertex3f(-0.0804, 0.0250, 0.7860);
-        glVertex3f(-0.0958, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(-0.0933, -0.0350, 0.7142);
-        glVertex3f(0.0000, -0.0450, 0.7860);
-        glVertex3f(-0.0804, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(0.0000, -0.0450, 0.7860);
-        glVertex3f(-0.0933, -0.0350, 0.7142);
-        glVertex3f(0.0000, -0.0350, 0.7142);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glVertex3f(-0.0804, -0.0450, 0.7860);
-        glVertex3f(-0.0958, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9905, -0.1379);
-        glVertex3f(-0.0804, -0.0450, 0.7860);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glVertex3f(-0.0933, -0.0350, 0.7142);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9780, 0.0000, 0.2085);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glVertex3f(-0.0958, 0.0250, 0.7860);
-        glVertex3f(-0.1111, 0.0350, 0.7142);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9780, 0.0000, 0.2085);
-        glVertex3f(-0.0958, 0.0250, 0.7860);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glVertex3f(-0.0958, -0.0450, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(-0.0933, 0.0350, 0.7142);
-        glVertex3f(-0.0958, 0.0250, 0.7860);
-        glVertex3f(-0.0804, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(-0.0958, 0.0250, 0.7860);
-        glVertex3f(-0.0933, 0.0350, 0.7142);
-        glVertex3f(-0.1111, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9867, 0.1624);
-        glVertex3f(-0.1183, 0.1150, 0.2282);
-        glVertex3f(-0.1111, 0.0350, 0.7142);
-        glVertex3f(-0.0933, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9867, 0.1624);
-        glVertex3f(-0.1111, 0.0350, 0.7142);
-        glVertex3f(-0.1183, 0.1150, 0.2282);
-        glVertex3f(-0.1414, 0.1150, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(-0.1414, -0.0450, 0.2282);
-        glVertex3f(-0.0933, -0.0350, 0.7142);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(-0.0933, -0.0350, 0.7142);
-        glVertex3f(-0.1414, -0.0450, 0.2282);
-        glVertex3f(-0.1183, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(-0.1183, -0.0450, 0.2282);
-        glVertex3f(0.0000, -0.0350, 0.7142);
-        glVertex3f(-0.0933, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(0.0000, -0.0350, 0.7142);
-        glVertex3f(-0.1183, -0.0450, 0.2282);
-        glVertex3f(0.0000, -0.0450, 0.2282);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9992, 0.0406);
-        glVertex3f(-0.0484, -0.0200, 1.2889);
-        glVertex3f(-0.0500, -0.0300, 1.5353);
-        glVertex3f(-0.0417, -0.0300, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9992, 0.0406);
-        glVertex3f(-0.0500, -0.0300, 1.5353);
-        glVertex3f(-0.0484, -0.0200, 1.2889);
-        glVertex3f(-0.0580, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9995, 0.0000, 0.0323);
-        glVertex3f(-0.0580, -0.0900, 1.2889);
-        glVertex3f(-0.0500, -0.0300, 1.5353);
-        glVertex3f(-0.0580, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9995, 0.0000, 0.0323);
-        glVertex3f(-0.0500, -0.0300, 1.5353);
-        glVertex3f(-0.0580, -0.0900, 1.2889);
-        glVertex3f(-0.0500, -0.1000, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9992, -0.0406);
-        glVertex3f(-0.0580, -0.0900, 1.2889);
-        glVertex3f(-0.0417, -0.1000, 1.5353);
-        glVertex3f(-0.0500, -0.1000, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9992, -0.0406);
-        glVertex3f(-0.0417, -0.1000, 1.5353);
-        glVertex3f(-0.0580, -0.0900, 1.2889);
-        glVertex3f(-0.0484, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9992, -0.0406);
-        glVertex3f(-0.0484, -0.0900, 1.2889);
-        glVertex3f(0.0000, -0.1000, 1.5353);
-        glVertex3f(-0.0417, -0.1000, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9992, -0.0406);
-        glVertex3f(0.0000, -0.1000, 1.5353);
-        glVertex3f(-0.0484, -0.0900, 1.2889);
-        glVertex3f(0.0000, -0.0900, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9967, 0.0809);
-        glVertex3f(0.0000, 0.0150, 0.8579);
-        glVertex3f(-0.0484, -0.0200, 1.2889);
-        glVertex3f(0.0000, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9967, 0.0809);
-        glVertex3f(-0.0484, -0.0200, 1.2889);
-        glVertex3f(0.0000, 0.0150, 0.8579);
-        glVertex3f(-0.0723, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0000, 0.0250, 0.7860);
-        glVertex3f(-0.0723, 0.0150, 0.8579);
-        glVertex3f(0.0000, 0.0150, 0.8579);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(-0.0723, 0.0150, 0.8579);
-        glVertex3f(0.0000, 0.0250, 0.7860);
-        glVertex3f(-0.0804, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(0.0000, 0.0350, 0.7142);
-        glVertex3f(-0.0804, 0.0250, 0.7860);
-        glVertex3f(0.0000, 0.0250, 0.7860);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9905, 0.1379);
-        glVertex3f(-0.0804, 0.0250, 0.7860);
-        glVertex3f(0.0000, 0.0350, 0.7142);
-        glVertex3f(-0.0933, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9867, 0.1624);
-        glVertex3f(0.0000, 0.1150, 0.2282);
-        glVertex3f(-0.0933, 0.0350, 0.7142);
-        glVertex3f(0.0000, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9867, 0.1624);
-        glVertex3f(-0.0933, 0.0350, 0.7142);
-        glVertex3f(0.0000, 0.1150, 0.2282);
-        glVertex3f(-0.1183, 0.1150, 0.2282);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9992, 0.0406);
-        glVertex3f(0.0000, -0.0200, 1.2889);
-        glVertex3f(-0.0417, -0.0300, 1.5353);
-        glVertex3f(0.0000, -0.0300, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9992, 0.0406);
-        glVertex3f(-0.0417, -0.0300, 1.5353);
-        glVertex3f(0.0000, -0.0200, 1.2889);
-        glVertex3f(-0.0484, -0.0200, 1.2889);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0011, 0.0000, -1.0000);
-        glVertex3f(-1.3853, -0.2190, -0.4758);
-        glVertex3f(-1.2902, -0.1198, -0.4759);
-        glVertex3f(-1.2902, -0.1596, -0.4759);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0011, 0.0000, -1.0000);
-        glVertex3f(-1.2902, -0.1198, -0.4759);
-        glVertex3f(-1.3853, -0.2190, -0.4758);
-        glVertex3f(-1.3853, -0.0597, -0.4758);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2744, -0.9375, 0.2141);
-        glVertex3f(-1.3853, -0.2190, -0.4758);
-        glVertex3f(-1.2901, -0.1598, -0.3385);
-        glVertex3f(-1.4952, -0.2198, -0.3384);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.5298, -0.8481, -0.0016);
-        glVertex3f(-1.2901, -0.1598, -0.3385);
-        glVertex3f(-1.3853, -0.2190, -0.4758);
-        glVertex3f(-1.2902, -0.1596, -0.4759);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.7808, -0.0000, -0.6248);
-        glVertex3f(-1.3853, -0.2190, -0.4758);
-        glVertex3f(-1.4952, -0.0605, -0.3384);
-        glVertex3f(-1.3853, -0.0597, -0.4758);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.7808, 0.0000, -0.6248);
-        glVertex3f(-1.4952, -0.0605, -0.3384);
-        glVertex3f(-1.3853, -0.2190, -0.4758);
-        glVertex3f(-1.4952, -0.2198, -0.3384);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2717, 0.9362, 0.2229);
-        glVertex3f(-1.2901, -0.1200, -0.3385);
-        glVertex3f(-1.3853, -0.0597, -0.4758);
-        glVertex3f(-1.4952, -0.0605, -0.3384);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.5342, 0.8453, 0.0008);
-        glVertex3f(-1.3853, -0.0597, -0.4758);
-        glVertex3f(-1.2901, -0.1200, -0.3385);
-        glVertex3f(-1.2902, -0.1198, -0.4759);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(1.0000, 0.0000, -0.0007);
-        glVertex3f(-1.2901, -0.1200, -0.3385);
-        glVertex3f(-1.2902, -0.1596, -0.4759);
-        glVertex3f(-1.2902, -0.1198, -0.4759);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(1.0000, 0.0000, -0.0007);
-        glVertex3f(-1.2902, -0.1596, -0.4759);
-        glVertex3f(-1.2901, -0.1200, -0.3385);
-        glVertex3f(-1.2901, -0.1598, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0011, 0.0000, 1.0000);
-        glVertex3f(-1.3853, -0.0597, 0.5524);
-        glVertex3f(-1.2902, -0.1596, 0.5523);
-        glVertex3f(-1.2902, -0.1198, 0.5523);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0011, 0.0000, 1.0000);
-        glVertex3f(-1.2902, -0.1596, 0.5523);
-        glVertex3f(-1.3853, -0.0597, 0.5524);
-        glVertex3f(-1.3853, -0.2190, 0.5524);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.5322, 0.8423, -0.0854);
-        glVertex3f(-1.2902, -0.1198, 0.5523);
-        glVertex3f(-1.4952, -0.0605, -0.1399);
-        glVertex3f(-1.3853, -0.0597, 0.5524);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2786, 0.9604, -0.0002);
-        glVertex3f(-1.4952, -0.0605, -0.1399);
-        glVertex3f(-1.2902, -0.1198, 0.5523);
-        glVertex3f(-1.2901, -0.1200, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9876, 0.0000, 0.1568);
-        glVertex3f(-1.4952, -0.0605, -0.1399);
-        glVertex3f(-1.3853, -0.2190, 0.5524);
-        glVertex3f(-1.3853, -0.0597, 0.5524);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9876, 0.0000, 0.1568);
-        glVertex3f(-1.3853, -0.2190, 0.5524);
-        glVertex3f(-1.4952, -0.0605, -0.1399);
-        glVertex3f(-1.4952, -0.2198, -0.1399);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.5279, -0.8453, -0.0828);
-        glVertex3f(-1.4952, -0.2198, -0.1399);
-        glVertex3f(-1.2902, -0.1596, 0.5523);
-        glVertex3f(-1.3853, -0.2190, 0.5524);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2808, -0.9598, 0.0003);
-        glVertex3f(-1.2902, -0.1596, 0.5523);
-        glVertex3f(-1.4952, -0.2198, -0.1399);
-        glVertex3f(-1.2901, -0.1598, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(1.0000, 0.0000, 0.0001);
-        glVertex3f(-1.2902, -0.1596, 0.5523);
-        glVertex3f(-1.2901, -0.1200, -0.1400);
-        glVertex3f(-1.2902, -0.1198, 0.5523);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(1.0000, -0.0000, 0.0001);
-        glVertex3f(-1.2901, -0.1200, -0.1400);
-        glVertex3f(-1.2902, -0.1596, 0.5523);
-        glVertex3f(-1.2901, -0.1598, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-1.0000, 0.0000, 0.0000);
-        glVertex3f(-1.4952, -0.2198, -0.3384);
-        glVertex3f(-1.4952, -0.0605, -0.1399);
-        glVertex3f(-1.4952, -0.0605, -0.3384);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-1.0000, 0.0000, -0.0000);
-        glVertex3f(-1.4952, -0.0605, -0.1399);
-        glVertex3f(-1.4952, -0.2198, -0.3384);
-        glVertex3f(-1.4952, -0.2198, -0.1399);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2786, 0.9604, 0.0000);
-        glVertex3f(-1.2901, -0.1200, -0.1400);
-        glVertex3f(-1.4952, -0.0605, -0.3384);
-        glVertex3f(-1.4952, -0.0605, -0.1399);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2786, 0.9604, 0.0000);
-        glVertex3f(-1.4952, -0.0605, -0.3384);
-        glVertex3f(-1.2901, -0.1200, -0.1400);
-        glVertex3f(-1.2901, -0.1200, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2808, -0.9598, 0.0000);
-        glVertex3f(-1.4952, -0.2198, -0.3384);
-        glVertex3f(-1.2901, -0.1598, -0.1400);
-        glVertex3f(-1.4952, -0.2198, -0.1399);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2808, -0.9598, 0.0000);
-        glVertex3f(-1.2901, -0.1598, -0.1400);
-        glVertex3f(-1.4952, -0.2198, -0.3384);
-        glVertex3f(-1.2901, -0.1598, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0057, 1.0000, 0.0000);
-        glVertex3f(-1.2550, -0.1202, -0.2063);
-        glVertex3f(-1.2901, -0.1200, -0.3385);
-        glVertex3f(-1.2901, -0.1200, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0057, 1.0000, 0.0000);
-        glVertex3f(-1.2901, -0.1200, -0.3385);
-        glVertex3f(-1.2550, -0.1202, -0.2063);
-        glVertex3f(-1.2550, -0.1202, -0.3386);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0029, 0.0000, -1.0000);
-        glVertex3f(-1.2901, -0.1598, -0.3385);
-        glVertex3f(-1.2901, -0.1200, -0.3385);
-        glVertex3f(-1.2550, -0.1202, -0.3386);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.6476, -0.5752, -0.4998);
-        glVertex3f(-1.2901, -0.1598, -0.3385);
-        glVertex3f(-1.2550, -0.1202, -0.3386);
-        glVertex3f(-1.2550, -0.1600, -0.2928);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0057, -1.0000, 0.0000);
-        glVertex3f(-1.2901, -0.1598, -0.1400);
-        glVertex3f(-1.2550, -0.1600, -0.2928);
-        glVertex3f(-1.2550, -0.1600, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0057, -1.0000, 0.0000);
-        glVertex3f(-1.2550, -0.1600, -0.2928);
-        glVertex3f(-1.2901, -0.1598, -0.1400);
-        glVertex3f(-1.2901, -0.1598, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.8837, 0.0000, 0.4680);
-        glVertex3f(-1.2901, -0.1598, -0.1400);
-        glVertex3f(-1.2550, -0.1202, -0.2063);
-        glVertex3f(-1.2901, -0.1200, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0063, 0.8569, 0.5154);
-        glVertex3f(-1.2550, -0.1202, -0.2063);
-        glVertex3f(-1.2901, -0.1598, -0.1400);
-        glVertex3f(-1.2550, -0.1600, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2084, 0.9780, 0.0000);
-        glVertex3f(-0.3150, 0.0801, -0.2059);
-        glVertex3f(-1.2550, -0.1202, -0.3386);
-        glVertex3f(-1.2550, -0.1202, -0.2063);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2066, 0.9783, -0.0127);
-        glVertex3f(-1.2550, -0.1202, -0.3386);
-        glVertex3f(-0.3150, 0.0801, -0.2059);
-        glVertex3f(-0.4850, 0.0393, -0.5830);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0991, 0.4634, 0.8806);
-        glVertex3f(-1.2550, -0.1202, -0.2063);
-        glVertex3f(-0.3150, -0.0450, -0.1401);
-        glVertex3f(-0.3150, 0.0801, -0.2059);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.1043, 0.8523, 0.5126);
-        glVertex3f(-0.3150, -0.0450, -0.1401);
-        glVertex3f(-1.2550, -0.1202, -0.2063);
-        glVertex3f(-1.2550, -0.1600, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.1214, -0.9926, 0.0000);
-        glVertex3f(-1.2550, -0.1600, -0.2928);
-        glVertex3f(-0.3150, -0.0450, -0.1401);
-        glVertex3f(-1.2550, -0.1600, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.1308, -0.9896, -0.0601);
-        glVertex3f(-0.3150, -0.0450, -0.1401);
-        glVertex3f(-1.2550, -0.1600, -0.2928);
-        glVertex3f(-0.4850, -0.0450, -0.5102);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.1154, -0.6491, -0.7519);
-        glVertex3f(-1.2550, -0.1600, -0.2928);
-        glVertex3f(-0.4850, 0.0393, -0.5830);
-        glVertex3f(-0.4850, -0.0450, -0.5102);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0517, -0.7539, -0.6550);
-        glVertex3f(-0.4850, 0.0393, -0.5830);
-        glVertex3f(-1.2550, -0.1600, -0.2928);
-        glVertex3f(-1.2550, -0.1202, -0.3386);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9119, 0.0079, 0.4103);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.4850, 0.0393, -0.5830);
-        glVertex3f(-0.3150, 0.0801, -0.2059);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.4435, 0.8922, -0.0848);
-        glVertex3f(-0.4850, 0.0393, -0.5830);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.2729, 0.1400, -0.6322);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9778, 0.0976, 0.1854);
-        glVertex3f(-0.3150, -0.0450, -0.1401);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.3150, 0.0801, -0.2059);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.8305, 0.1436, 0.5382);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.3150, -0.0450, -0.1401);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.8982, -0.1516, 0.4125);
-        glVertex3f(-0.4850, -0.0450, -0.5102);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glVertex3f(-0.3150, -0.0450, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.1631, -0.9866, -0.0025);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glVertex3f(-0.4850, -0.0450, -0.5102);
-        glVertex3f(-0.2729, -0.0800, -0.5289);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.1481, -0.4203, -0.8952);
-        glVertex3f(-0.4850, -0.0450, -0.5102);
-        glVertex3f(-0.2729, 0.1400, -0.6322);
-        glVertex3f(-0.2729, -0.0800, -0.5289);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.1336, -0.6476, -0.7502);
-        glVertex3f(-0.2729, 0.1400, -0.6322);
-        glVertex3f(-0.4850, -0.0450, -0.5102);
-        glVertex3f(-0.4850, 0.0393, -0.5830);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0000, -0.0050, 1.6304);
-        glVertex3f(-0.0625, -0.0050, 1.8147);
-        glVertex3f(0.0000, -0.0050, 1.8147);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0000, 1.0000, -0.0000);
-        glVertex3f(-0.0625, -0.0050, 1.8147);
-        glVertex3f(0.0000, -0.0050, 1.6304);
-        glVertex3f(-0.0564, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9671, -0.2543);
-        glVertex3f(0.0000, -0.0300, 1.5353);
-        glVertex3f(-0.0564, -0.0050, 1.6304);
-        glVertex3f(0.0000, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9671, -0.2543);
-        glVertex3f(-0.0564, -0.0050, 1.6304);
-        glVertex3f(0.0000, -0.0300, 1.5353);
-        glVertex3f(-0.0417, -0.0300, 1.5353);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9908, 0.1353);
-        glVertex3f(0.0000, 0.1700, -0.1745);
-        glVertex3f(-0.1183, 0.1150, 0.2282);
-        glVertex3f(0.0000, 0.1150, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9908, 0.1353);
-        glVertex3f(-0.1183, 0.1150, 0.2282);
-        glVertex3f(0.0000, 0.1700, -0.1745);
-        glVertex3f(-0.2479, 0.1700, -0.1745);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0000, 0.1700, -0.5762);
-        glVertex3f(-0.2479, 0.1700, -0.1745);
-        glVertex3f(0.0000, 0.1700, -0.1745);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, 1.0000, -0.0000);
-        glVertex3f(-0.2479, 0.1700, -0.1745);
-        glVertex3f(0.0000, 0.1700, -0.5762);
-        glVertex3f(-0.1960, 0.1700, -0.5762);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.0000, 1.0000);
-        glVertex3f(-0.1944, 0.0150, 0.2831);
-        glVertex3f(-0.1278, -0.0250, 0.2831);
-        glVertex3f(-0.1278, 0.0150, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.0000, 1.0000);
-        glVertex3f(-0.1278, -0.0250, 0.2831);
-        glVertex3f(-0.1944, 0.0150, 0.2831);
-        glVertex3f(-0.1944, -0.0250, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0748, -0.9972, 0.0000);
-        glVertex3f(-0.1944, 0.0150, 0.2831);
-        glVertex3f(-0.1278, 0.0200, 0.6926);
-        glVertex3f(-0.1944, 0.0150, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9999, 0.0122);
-        glVertex3f(-0.1278, 0.0200, 0.6926);
-        glVertex3f(-0.1944, 0.0150, 0.2831);
-        glVertex3f(-0.1278, 0.0150, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(1.0000, 0.0000, 0.0000);
-        glVertex3f(-0.1944, -0.0250, 0.6064);
-        glVertex3f(-0.1944, 0.0150, 0.2831);
-        glVertex3f(-0.1944, 0.0150, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(1.0000, 0.0000, -0.0000);
-        glVertex3f(-0.1944, 0.0150, 0.2831);
-        glVertex3f(-0.1944, -0.0250, 0.6064);
-        glVertex3f(-0.1944, -0.0250, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.1278, -0.0250, 0.2831);
-        glVertex3f(-0.1944, -0.0250, 0.6064);
-        glVertex3f(-0.1278, -0.0250, 0.6926);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.1944, -0.0250, 0.6064);
-        glVertex3f(-0.1278, -0.0250, 0.2831);
-        glVertex3f(-0.1944, -0.0250, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-1.0000, 0.0000, 0.0000);
-        glVertex3f(-0.1278, -0.0250, 0.2831);
-        glVertex3f(-0.1278, 0.0200, 0.6926);
-        glVertex3f(-0.1278, 0.0150, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-1.0000, 0.0000, -0.0000);
-        glVertex3f(-0.1278, 0.0200, 0.6926);
-        glVertex3f(-0.1278, -0.0250, 0.2831);
-        glVertex3f(-0.1278, -0.0250, 0.6926);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.7911, 0.0000, 0.6117);
-        glVertex3f(-0.2000, 0.0200, 0.5992);
-        glVertex3f(-0.1278, 0.0200, 0.6926);
-        glVertex3f(-0.1111, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.7911, -0.0001, 0.6117);
-        glVertex3f(-0.1278, 0.0200, 0.6926);
-        glVertex3f(-0.2000, 0.0200, 0.5992);
-        glVertex3f(-0.1944, 0.0150, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.7910, 0.0000, 0.6118);
-        glVertex3f(-0.2000, 0.0200, 0.5992);
-        glVertex3f(-0.1944, -0.0250, 0.6064);
-        glVertex3f(-0.1944, 0.0150, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.7910, 0.0000, 0.6118);
-        glVertex3f(-0.1944, -0.0250, 0.6064);
-        glVertex3f(-0.2000, 0.0200, 0.5992);
-        glVertex3f(-0.2000, -0.0300, 0.5992);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.7911, 0.0001, 0.6117);
-        glVertex3f(-0.2000, -0.0300, 0.5992);
-        glVertex3f(-0.1278, -0.0250, 0.6926);
-        glVertex3f(-0.1944, -0.0250, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.7911, -0.0000, 0.6117);
-        glVertex3f(-0.1278, -0.0250, 0.6926);
-        glVertex3f(-0.2000, -0.0300, 0.5992);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.7911, 0.0000, 0.6117);
-        glVertex3f(-0.1278, -0.0250, 0.6926);
-        glVertex3f(-0.1111, 0.0350, 0.7142);
-        glVertex3f(-0.1278, 0.0200, 0.6926);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.7911, 0.0000, 0.6117);
-        glVertex3f(-0.1111, 0.0350, 0.7142);
-        glVertex3f(-0.1278, -0.0250, 0.6926);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.9831, 0.0000, 0.1833);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.2250, -0.0450, 0.2282);
-        glVertex3f(-0.2250, 0.1000, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.9839, -0.0090, 0.1786);
-        glVertex3f(-0.2250, -0.0450, 0.2282);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.9977, 0.0000, 0.0672);
-        glVertex3f(-0.2250, 0.1000, 0.2282);
-        glVertex3f(-0.2000, -0.0300, 0.5992);
-        glVertex3f(-0.2000, 0.0200, 0.5992);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.9977, 0.0000, 0.0672);
-        glVertex3f(-0.2000, -0.0300, 0.5992);
-        glVertex3f(-0.2250, 0.1000, 0.2282);
-        glVertex3f(-0.2250, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.1731, 0.9644, 0.2001);
-        glVertex3f(-0.2250, 0.1000, 0.2282);
-        glVertex3f(-0.1414, 0.1150, 0.2282);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9935, 0.1138);
-        glVertex3f(-0.2250, -0.0450, 0.2282);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glVertex3f(-0.1414, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.3776, 0.9096, 0.1733);
-        glVertex3f(-0.1414, 0.1150, 0.2282);
-        glVertex3f(-0.2000, 0.0200, 0.5992);
-        glVertex3f(-0.1111, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.1724, 0.9604, 0.2187);
-        glVertex3f(-0.2000, 0.0200, 0.5992);
-        glVertex3f(-0.1414, 0.1150, 0.2282);
-        glVertex3f(-0.2250, 0.1000, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.1179, -0.9919, 0.0480);
-        glVertex3f(-0.2250, -0.0450, 0.2282);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glVertex3f(-0.2000, -0.0300, 0.5992);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9998, 0.0206);
-        glVertex3f(-0.1111, -0.0350, 0.7142);
-        glVertex3f(-0.2250, -0.0450, 0.2282);
-        glVertex3f(-0.1414, -0.0450, 0.2282);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.0000, 1.0000);
-        glVertex3f(-0.0417, -0.0850, 2.0741);
-        glVertex3f(0.0000, -0.1050, 2.0741);
-        glVertex3f(0.0000, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.0000, 1.0000);
-        glVertex3f(0.0000, -0.1050, 2.0741);
-        glVertex3f(-0.0417, -0.0850, 2.0741);
-        glVertex3f(-0.0417, -0.1050, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9556, 0.2946);
-        glVertex3f(0.0000, -0.0050, 1.8147);
-        glVertex3f(-0.0417, -0.0850, 2.0741);
-        glVertex3f(0.0000, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9556, 0.2946);
-        glVertex3f(-0.0417, -0.0850, 2.0741);
-        glVertex3f(0.0000, -0.0050, 1.8147);
-        glVertex3f(-0.0625, -0.0050, 1.8147);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9940, 0.1098);
-        glVertex3f(-0.0625, -0.1400, 1.7572);
-        glVertex3f(0.0000, -0.1050, 2.0741);
-        glVertex3f(-0.0417, -0.1050, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9940, 0.1098);
-        glVertex3f(0.0000, -0.1050, 2.0741);
-        glVertex3f(-0.0625, -0.1400, 1.7572);
-        glVertex3f(0.0000, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9931, -0.1175);
-        glVertex3f(-0.0564, -0.1250, 1.6304);
-        glVertex3f(0.0000, -0.1400, 1.7572);
-        glVertex3f(-0.0625, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9931, -0.1175);
-        glVertex3f(0.0000, -0.1400, 1.7572);
-        glVertex3f(-0.0564, -0.1250, 1.6304);
-        glVertex3f(0.0000, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.0000, 1.0000);
-        glVertex3f(-0.0542, -0.0850, 2.0741);
-        glVertex3f(-0.0417, -0.1050, 2.0741);
-        glVertex3f(-0.0417, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.0000, 1.0000);
-        glVertex3f(-0.0417, -0.1050, 2.0741);
-        glVertex3f(-0.0542, -0.0850, 2.0741);
-        glVertex3f(-0.0542, -0.1050, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9556, 0.2946);
-        glVertex3f(-0.0625, -0.0050, 1.8147);
-        glVertex3f(-0.0542, -0.0850, 2.0741);
-        glVertex3f(-0.0417, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9556, 0.2946);
-        glVertex3f(-0.0542, -0.0850, 2.0741);
-        glVertex3f(-0.0625, -0.0050, 1.8147);
-        glVertex3f(-0.1250, -0.0050, 1.8147);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9647, 0.0000, 0.2633);
-        glVertex3f(-0.1250, -0.0050, 1.8147);
-        glVertex3f(-0.0542, -0.1050, 2.0741);
-        glVertex3f(-0.0542, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9690, -0.0968, 0.2272);
-        glVertex3f(-0.0542, -0.1050, 2.0741);
-        glVertex3f(-0.1250, -0.0050, 1.8147);
-        glVertex3f(-0.1250, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9940, 0.1098);
-        glVertex3f(-0.1250, -0.1400, 1.7572);
-        glVertex3f(-0.0417, -0.1050, 2.0741);
-        glVertex3f(-0.0542, -0.1050, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9940, 0.1098);
-        glVertex3f(-0.0417, -0.1050, 2.0741);
-        glVertex3f(-0.1250, -0.1400, 1.7572);
-        glVertex3f(-0.0625, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9877, -0.0000, -0.1563);
-        glVertex3f(-0.0958, -0.1250, 1.6304);
-        glVertex3f(-0.1250, -0.0050, 1.8147);
-        glVertex3f(-0.0958, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9728, 0.0907, -0.2131);
-        glVertex3f(-0.1250, -0.0050, 1.8147);
-        glVertex3f(-0.0958, -0.1250, 1.6304);
-        glVertex3f(-0.1250, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.0564, -0.0050, 1.6304);
-        glVertex3f(-0.1250, -0.0050, 1.8147);
-        glVertex3f(-0.0625, -0.0050, 1.8147);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0000, 1.0000, -0.0000);
-        glVertex3f(-0.1250, -0.0050, 1.8147);
-        glVertex3f(-0.0564, -0.0050, 1.6304);
-        glVertex3f(-0.0958, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9931, -0.1175);
-        glVertex3f(-0.0958, -0.1250, 1.6304);
-        glVertex3f(-0.0625, -0.1400, 1.7572);
-        glVertex3f(-0.1250, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9931, -0.1175);
-        glVertex3f(-0.0625, -0.1400, 1.7572);
-        glVertex3f(-0.0958, -0.1250, 1.6304);
-        glVertex3f(-0.0564, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9671, -0.2543);
-        glVertex3f(-0.0417, -0.0300, 1.5353);
-        glVertex3f(-0.0958, -0.0050, 1.6304);
-        glVertex3f(-0.0564, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9671, -0.2543);
-        glVertex3f(-0.0958, -0.0050, 1.6304);
-        glVertex3f(-0.0417, -0.0300, 1.5353);
-        glVertex3f(-0.0500, -0.0300, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9008, -0.0000, -0.4342);
-        glVertex3f(-0.0500, -0.1000, 1.5353);
-        glVertex3f(-0.0958, -0.0050, 1.6304);
-        glVertex3f(-0.0500, -0.0300, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.9008, 0.0000, -0.4342);
-        glVertex3f(-0.0958, -0.0050, 1.6304);
-        glVertex3f(-0.0500, -0.1000, 1.5353);
-        glVertex3f(-0.0958, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9671, -0.2543);
-        glVertex3f(-0.0500, -0.1000, 1.5353);
-        glVertex3f(-0.0564, -0.1250, 1.6304);
-        glVertex3f(-0.0958, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9671, -0.2543);
-        glVertex3f(-0.0564, -0.1250, 1.6304);
-        glVertex3f(-0.0500, -0.1000, 1.5353);
-        glVertex3f(-0.0417, -0.1000, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9671, -0.2543);
-        glVertex3f(-0.0417, -0.1000, 1.5353);
-        glVertex3f(0.0000, -0.1250, 1.6304);
-        glVertex3f(-0.0564, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9671, -0.2543);
-        glVertex3f(0.0000, -0.1250, 1.6304);
-        glVertex3f(-0.0417, -0.1000, 1.5353);
-        glVertex3f(0.0000, -0.1000, 1.5353);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, 0.9908, 0.1355);
-        glVertex3f(-0.1183, 0.1150, 0.2282);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.1414, 0.1150, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0011, 0.9908, 0.1350);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.1183, 0.1150, 0.2282);
-        glVertex3f(-0.2479, 0.1700, -0.1745);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9935, 0.1138);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glVertex3f(-0.1183, -0.0450, 0.2282);
-        glVertex3f(-0.1414, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0013, -0.9934, 0.1145);
-        glVertex3f(-0.1183, -0.0450, 0.2282);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glVertex3f(-0.2479, -0.0800, -0.0769);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9935, 0.1140);
-        glVertex3f(-0.2479, -0.0800, -0.0769);
-        glVertex3f(0.0000, -0.0450, 0.2282);
-        glVertex3f(-0.1183, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9935, 0.1140);
-        glVertex3f(0.0000, -0.0450, 0.2282);
-        glVertex3f(-0.2479, -0.0800, -0.0769);
-        glVertex3f(0.0000, -0.0800, -0.0769);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0010, 1.0000, 0.0001);
-        glVertex3f(-0.1960, 0.1700, -0.5762);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.2479, 0.1700, -0.1745);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.3105, 0.9471, -0.0806);
-        glVertex3f(-0.3000, 0.1700, -0.1744);
-        glVertex3f(-0.1960, 0.1700, -0.5762);
-        glVertex3f(-0.2729, 0.1400, -0.6322);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0016, -1.0000, -0.0002);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glVertex3f(-0.1960, -0.0800, -0.4729);
-        glVertex3f(-0.2479, -0.0800, -0.0769);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0001, -1.0000, 0.0001);
-        glVertex3f(-0.1960, -0.0800, -0.4729);
-        glVertex3f(-0.2801, -0.0799, -0.0768);
-        glVertex3f(-0.2729, -0.0800, -0.5289);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(-0.1960, -0.0800, -0.4729);
-        glVertex3f(0.0000, -0.0800, -0.0769);
-        glVertex3f(-0.2479, -0.0800, -0.0769);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.0000, -0.0800, -0.0769);
-        glVertex3f(-0.1960, -0.0800, -0.4729);
-        glVertex3f(0.0000, -0.0800, -0.4729);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.1652, 0.9458, -0.2796);
-        glVertex3f(-0.1540, 0.1400, -0.7024);
-        glVertex3f(-0.2729, 0.1400, -0.6322);
-        glVertex3f(-0.1960, 0.1700, -0.5762);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, -0.0000);
-        glVertex3f(-0.2729, 0.1400, -0.6322);
-        glVertex3f(-0.1540, 0.1400, -0.7024);
-        glVertex3f(-0.1980, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.6840, -0.0000, -0.7295);
-        glVertex3f(-0.1980, 0.0300, -0.7024);
-        glVertex3f(-0.2729, 0.1400, -0.6322);
-        glVertex3f(-0.1980, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.8273, -0.2388, -0.5085);
-        glVertex3f(-0.2729, 0.1400, -0.6322);
-        glVertex3f(-0.1980, 0.0300, -0.7024);
-        glVertex3f(-0.2729, -0.0800, -0.5289);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.3013, -0.8589, -0.4142);
-        glVertex3f(-0.1980, 0.0300, -0.7024);
-        glVertex3f(-0.1960, -0.0800, -0.4729);
-        glVertex3f(-0.2729, -0.0800, -0.5289);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9018, -0.4321);
-        glVertex3f(-0.1960, -0.0800, -0.4729);
-        glVertex3f(-0.1980, 0.0300, -0.7024);
-        glVertex3f(-0.1540, 0.0300, -0.7024);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9018, -0.4321);
-        glVertex3f(-0.1540, 0.0300, -0.7024);
-        glVertex3f(0.0000, -0.0800, -0.4729);
-        glVertex3f(-0.1960, -0.0800, -0.4729);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9018, -0.4321);
-        glVertex3f(0.0000, -0.0800, -0.4729);
-        glVertex3f(-0.1540, 0.0300, -0.7024);
-        glVertex3f(0.0000, 0.0300, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.9729, -0.2312);
-        glVertex3f(0.0000, 0.1400, -0.7024);
-        glVertex3f(-0.1960, 0.1700, -0.5762);
-        glVertex3f(0.0000, 0.1700, -0.5762);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.9729, -0.2312);
-        glVertex3f(-0.1960, 0.1700, -0.5762);
-        glVertex3f(0.0000, 0.1400, -0.7024);
-        glVertex3f(-0.1540, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.1540, 0.1400, -0.7713);
-        glVertex3f(-0.1980, 0.1400, -0.7024);
-        glVertex3f(-0.1540, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.1980, 0.1400, -0.7024);
-        glVertex3f(-0.1540, 0.1400, -0.7713);
-        glVertex3f(-0.1980, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-1.0000, 0.0000, 0.0000);
-        glVertex3f(-0.1980, 0.0300, -0.7420);
-        glVertex3f(-0.1980, 0.1400, -0.7024);
-        glVertex3f(-0.1980, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-1.0000, 0.0000, -0.0000);
-        glVertex3f(-0.1980, 0.1400, -0.7024);
-        glVertex3f(-0.1980, 0.0300, -0.7420);
-        glVertex3f(-0.1980, 0.0300, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(-0.1980, 0.0300, -0.7420);
-        glVertex3f(-0.1540, 0.0300, -0.7024);
-        glVertex3f(-0.1980, 0.0300, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(-0.1540, 0.0300, -0.7024);
-        glVertex3f(-0.1980, 0.0300, -0.7420);
-        glVertex3f(-0.1540, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(-0.1540, 0.0300, -0.7420);
-        glVertex3f(0.0000, 0.0300, -0.7024);
-        glVertex3f(-0.1540, 0.0300, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.0000, 0.0300, -0.7024);
-        glVertex3f(-0.1540, 0.0300, -0.7420);
-        glVertex3f(0.0000, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0000, 0.1400, -0.7713);
-        glVertex3f(-0.1540, 0.1400, -0.7024);
-        glVertex3f(0.0000, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.1540, 0.1400, -0.7024);
-        glVertex3f(0.0000, 0.1400, -0.7713);
-        glVertex3f(-0.1540, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -0.7345, -0.6786);
-        glVertex3f(-0.1980, 0.1400, -0.7713);
-        glVertex3f(-0.1430, 0.1200, -0.7497);
-        glVertex3f(-0.1760, 0.1200, -0.7497);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -0.7345, -0.6786);
-        glVertex3f(-0.1430, 0.1200, -0.7497);
-        glVertex3f(-0.1980, 0.1400, -0.7713);
-        glVertex3f(-0.1540, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.5781, -0.2087, -0.7888);
-        glVertex3f(-0.1980, 0.0300, -0.7420);
-        glVertex3f(-0.1760, 0.1200, -0.7497);
-        glVertex3f(-0.1760, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.5825, -0.2095, -0.7854);
-        glVertex3f(-0.1760, 0.1200, -0.7497);
-        glVertex3f(-0.1980, 0.0300, -0.7420);
-        glVertex3f(-0.1980, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.4762, -0.8794);
-        glVertex3f(-0.1540, 0.0300, -0.7420);
-        glVertex3f(-0.1760, 0.0500, -0.7311);
-        glVertex3f(-0.1430, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.4762, -0.8794);
-        glVertex3f(-0.1760, 0.0500, -0.7311);
-        glVertex3f(-0.1540, 0.0300, -0.7420);
-        glVertex3f(-0.1980, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.4762, -0.8794);
-        glVertex3f(0.0000, 0.0300, -0.7420);
-        glVertex3f(-0.1430, 0.0500, -0.7311);
-        glVertex3f(0.0000, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.4762, -0.8794);
-        glVertex3f(-0.1430, 0.0500, -0.7311);
-        glVertex3f(0.0000, 0.0300, -0.7420);
-        glVertex3f(-0.1540, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -0.7345, -0.6786);
-        glVertex3f(-0.1540, 0.1400, -0.7713);
-        glVertex3f(0.0000, 0.1200, -0.7497);
-        glVertex3f(-0.1430, 0.1200, -0.7497);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -0.7345, -0.6786);
-        glVertex3f(0.0000, 0.1200, -0.7497);
-        glVertex3f(-0.1540, 0.1400, -0.7713);
-        glVertex3f(0.0000, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(-0.1760, 0.1200, -0.7497);
-        glVertex3f(-0.1430, 0.1200, -0.4614);
-        glVertex3f(-0.1760, 0.1200, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(-0.1430, 0.1200, -0.4614);
-        glVertex3f(-0.1760, 0.1200, -0.7497);
-        glVertex3f(-0.1430, 0.1200, -0.7497);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(1.0000, 0.0000, 0.0000);
-        glVertex3f(-0.1760, 0.0500, -0.4614);
-        glVertex3f(-0.1760, 0.1200, -0.7497);
-        glVertex3f(-0.1760, 0.1200, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(1.0000, -0.0000, -0.0000);
-        glVertex3f(-0.1760, 0.1200, -0.7497);
-        glVertex3f(-0.1760, 0.0500, -0.4614);
-        glVertex3f(-0.1760, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.1430, 0.0500, -0.7311);
-        glVertex3f(-0.1760, 0.0500, -0.4614);
-        glVertex3f(-0.1430, 0.0500, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.1760, 0.0500, -0.4614);
-        glVertex3f(-0.1430, 0.0500, -0.7311);
-        glVertex3f(-0.1760, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0000, 0.0500, -0.7311);
-        glVertex3f(-0.1430, 0.0500, -0.4614);
-        glVertex3f(0.0000, 0.0500, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(-0.1430, 0.0500, -0.4614);
-        glVertex3f(0.0000, 0.0500, -0.7311);
-        glVertex3f(-0.1430, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(-0.1430, 0.1200, -0.7497);
-        glVertex3f(0.0000, 0.1200, -0.4614);
-        glVertex3f(-0.1430, 0.1200, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.0000, 0.1200, -0.4614);
-        glVertex3f(-0.1430, 0.1200, -0.7497);
-        glVertex3f(0.0000, 0.1200, -0.7497);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.0000, -1.0000);
-        glVertex3f(-0.1430, 0.0500, -0.4614);
-        glVertex3f(0.0000, 0.1200, -0.4614);
-        glVertex3f(0.0000, 0.0500, -0.4614);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, 0.0000, -1.0000);
-        glVertex3f(-0.1430, 0.0500, -0.4614);
-        glVertex3f(-0.1430, 0.1200, -0.4614);
-        glVertex3f(0.0000, 0.1200, -0.4614);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.0000, -1.0000);
-        glVertex3f(-0.1760, 0.0500, -0.4614);
-        glVertex3f(-0.1430, 0.1200, -0.4614);
-        glVertex3f(-0.1430, 0.0500, -0.4614);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.0000, -1.0000);
-        glVertex3f(-0.1430, 0.1200, -0.4614);
-        glVertex3f(-0.1760, 0.0500, -0.4614);
-        glVertex3f(-0.1760, 0.1200, -0.4614);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0011, 0.0000, -1.0000);
-        glVertex3f(1.2902, -0.1596, -0.4759);
-        glVertex3f(1.3853, -0.0597, -0.4758);
-        glVertex3f(1.3853, -0.2190, -0.4758);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0011, 0.0000, -1.0000);
-        glVertex3f(1.3853, -0.0597, -0.4758);
-        glVertex3f(1.2902, -0.1596, -0.4759);
-        glVertex3f(1.2902, -0.1198, -0.4759);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2744, -0.9375, 0.2141);
-        glVertex3f(1.2901, -0.1598, -0.3385);
-        glVertex3f(1.3853, -0.2190, -0.4758);
-        glVertex3f(1.4952, -0.2198, -0.3384);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.5298, -0.8481, -0.0016);
-        glVertex3f(1.3853, -0.2190, -0.4758);
-        glVertex3f(1.2901, -0.1598, -0.3385);
-        glVertex3f(1.2902, -0.1596, -0.4759);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.7808, 0.0000, -0.6248);
-        glVertex3f(1.4952, -0.0605, -0.3384);
-        glVertex3f(1.3853, -0.2190, -0.4758);
-        glVertex3f(1.3853, -0.0597, -0.4758);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.7808, 0.0000, -0.6248);
-        glVertex3f(1.3853, -0.2190, -0.4758);
-        glVertex3f(1.4952, -0.0605, -0.3384);
-        glVertex3f(1.4952, -0.2198, -0.3384);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2717, 0.9362, 0.2229);
-        glVertex3f(1.3853, -0.0597, -0.4758);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glVertex3f(1.4952, -0.0605, -0.3384);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.5342, 0.8453, 0.0008);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glVertex3f(1.3853, -0.0597, -0.4758);
-        glVertex3f(1.2902, -0.1198, -0.4759);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-1.0000, -0.0000, -0.0007);
-        glVertex3f(1.2902, -0.1596, -0.4759);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glVertex3f(1.2902, -0.1198, -0.4759);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-1.0000, 0.0000, -0.0007);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glVertex3f(1.2902, -0.1596, -0.4759);
-        glVertex3f(1.2901, -0.1598, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0011, 0.0000, 1.0000);
-        glVertex3f(1.2902, -0.1198, 0.5523);
-        glVertex3f(1.3853, -0.2190, 0.5524);
-        glVertex3f(1.3853, -0.0597, 0.5524);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0011, 0.0000, 1.0000);
-        glVertex3f(1.3853, -0.2190, 0.5524);
-        glVertex3f(1.2902, -0.1198, 0.5523);
-        glVertex3f(1.2902, -0.1596, 0.5523);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.5322, 0.8423, -0.0854);
-        glVertex3f(1.4952, -0.0605, -0.1399);
-        glVertex3f(1.2902, -0.1198, 0.5523);
-        glVertex3f(1.3853, -0.0597, 0.5524);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2786, 0.9604, -0.0002);
-        glVertex3f(1.2902, -0.1198, 0.5523);
-        glVertex3f(1.4952, -0.0605, -0.1399);
-        glVertex3f(1.2901, -0.1200, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9876, 0.0000, 0.1568);
-        glVertex3f(1.3853, -0.2190, 0.5524);
-        glVertex3f(1.4952, -0.0605, -0.1399);
-        glVertex3f(1.3853, -0.0597, 0.5524);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9876, -0.0000, 0.1568);
-        glVertex3f(1.4952, -0.0605, -0.1399);
-        glVertex3f(1.3853, -0.2190, 0.5524);
-        glVertex3f(1.4952, -0.2198, -0.1399);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.5279, -0.8453, -0.0828);
-        glVertex3f(1.2902, -0.1596, 0.5523);
-        glVertex3f(1.4952, -0.2198, -0.1399);
-        glVertex3f(1.3853, -0.2190, 0.5524);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2808, -0.9598, 0.0003);
-        glVertex3f(1.4952, -0.2198, -0.1399);
-        glVertex3f(1.2902, -0.1596, 0.5523);
-        glVertex3f(1.2901, -0.1598, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-1.0000, 0.0000, 0.0001);
-        glVertex3f(1.2901, -0.1200, -0.1400);
-        glVertex3f(1.2902, -0.1596, 0.5523);
-        glVertex3f(1.2902, -0.1198, 0.5523);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-1.0000, 0.0000, 0.0001);
-        glVertex3f(1.2902, -0.1596, 0.5523);
-        glVertex3f(1.2901, -0.1200, -0.1400);
-        glVertex3f(1.2901, -0.1598, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(1.0000, 0.0000, 0.0000);
-        glVertex3f(1.4952, -0.2198, -0.1399);
-        glVertex3f(1.4952, -0.0605, -0.3384);
-        glVertex3f(1.4952, -0.0605, -0.1399);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(1.0000, 0.0000, -0.0000);
-        glVertex3f(1.4952, -0.0605, -0.3384);
-        glVertex3f(1.4952, -0.2198, -0.1399);
-        glVertex3f(1.4952, -0.2198, -0.3384);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2786, 0.9604, 0.0000);
-        glVertex3f(1.4952, -0.0605, -0.3384);
-        glVertex3f(1.2901, -0.1200, -0.1400);
-        glVertex3f(1.4952, -0.0605, -0.1399);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2786, 0.9604, 0.0000);
-        glVertex3f(1.2901, -0.1200, -0.1400);
-        glVertex3f(1.4952, -0.0605, -0.3384);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2808, -0.9598, 0.0000);
-        glVertex3f(1.2901, -0.1598, -0.1400);
-        glVertex3f(1.4952, -0.2198, -0.3384);
-        glVertex3f(1.4952, -0.2198, -0.1399);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2808, -0.9598, 0.0000);
-        glVertex3f(1.4952, -0.2198, -0.3384);
-        glVertex3f(1.2901, -0.1598, -0.1400);
-        glVertex3f(1.2901, -0.1598, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0057, 1.0000, 0.0000);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glVertex3f(1.2550, -0.1202, -0.2063);
-        glVertex3f(1.2901, -0.1200, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0057, 1.0000, 0.0000);
-        glVertex3f(1.2550, -0.1202, -0.2063);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glVertex3f(1.2550, -0.1202, -0.3386);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0062, -0.7549, -0.6558);
-        glVertex3f(1.2550, -0.1600, -0.2928);
-        glVertex3f(1.2550, -0.1202, -0.3386);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.7931, 0.0000, -0.6090);
-        glVertex3f(1.2550, -0.1600, -0.2928);
-        glVertex3f(1.2901, -0.1200, -0.3385);
-        glVertex3f(1.2901, -0.1598, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0057, -1.0000, 0.0000);
-        glVertex3f(1.2550, -0.1600, -0.2928);
-        glVertex3f(1.2901, -0.1598, -0.1400);
-        glVertex3f(1.2550, -0.1600, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0057, -1.0000, 0.0000);
-        glVertex3f(1.2901, -0.1598, -0.1400);
-        glVertex3f(1.2550, -0.1600, -0.2928);
-        glVertex3f(1.2901, -0.1598, -0.3385);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.8837, 0.0000, 0.4680);
-        glVertex3f(1.2550, -0.1202, -0.2063);
-        glVertex3f(1.2901, -0.1598, -0.1400);
-        glVertex3f(1.2901, -0.1200, -0.1400);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0063, 0.8569, 0.5154);
-        glVertex3f(1.2901, -0.1598, -0.1400);
-        glVertex3f(1.2550, -0.1202, -0.2063);
-        glVertex3f(1.2550, -0.1600, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2084, 0.9780, 0.0000);
-        glVertex3f(1.2550, -0.1202, -0.3386);
-        glVertex3f(0.3150, 0.0801, -0.2059);
-        glVertex3f(1.2550, -0.1202, -0.2063);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.2066, 0.9783, -0.0127);
-        glVertex3f(0.3150, 0.0801, -0.2059);
-        glVertex3f(1.2550, -0.1202, -0.3386);
-        glVertex3f(0.4850, 0.0393, -0.5830);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.1798, 0.8430, 0.5070);
-        glVertex3f(0.3150, 0.0801, -0.2059);
-        glVertex3f(1.2550, -0.1600, -0.1401);
-        glVertex3f(1.2550, -0.1202, -0.2063);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0569, 0.4649, 0.8835);
-        glVertex3f(1.2550, -0.1600, -0.1401);
-        glVertex3f(0.3150, 0.0801, -0.2059);
-        glVertex3f(0.3150, -0.0450, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.1214, -0.9926, 0.0000);
-        glVertex3f(0.3150, -0.0450, -0.1401);
-        glVertex3f(1.2550, -0.1600, -0.2928);
-        glVertex3f(1.2550, -0.1600, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.1308, -0.9896, -0.0601);
-        glVertex3f(1.2550, -0.1600, -0.2928);
-        glVertex3f(0.3150, -0.0450, -0.1401);
-        glVertex3f(0.4850, -0.0450, -0.5102);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0722, -0.7529, -0.6541);
-        glVertex3f(0.4850, -0.0450, -0.5102);
-        glVertex3f(1.2550, -0.1202, -0.3386);
-        glVertex3f(1.2550, -0.1600, -0.2928);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.1043, -0.6499, -0.7528);
-        glVertex3f(1.2550, -0.1202, -0.3386);
-        glVertex3f(0.4850, -0.0450, -0.5102);
-        glVertex3f(0.4850, 0.0393, -0.5830);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9119, 0.0079, 0.4103);
-        glVertex3f(0.4850, 0.0393, -0.5830);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.3150, 0.0801, -0.2059);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.4435, 0.8922, -0.0848);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.4850, 0.0393, -0.5830);
-        glVertex3f(0.2729, 0.1400, -0.6322);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9778, 0.0976, 0.1854);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.3150, -0.0450, -0.1401);
-        glVertex3f(0.3150, 0.0801, -0.2059);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.8305, 0.1436, 0.5382);
-        glVertex3f(0.3150, -0.0450, -0.1401);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.8982, -0.1516, 0.4125);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glVertex3f(0.4850, -0.0450, -0.5102);
-        glVertex3f(0.3150, -0.0450, -0.1401);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.1631, -0.9866, -0.0025);
-        glVertex3f(0.4850, -0.0450, -0.5102);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glVertex3f(0.2729, -0.0800, -0.5289);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.1718, -0.6437, -0.7457);
-        glVertex3f(0.2729, -0.0800, -0.5289);
-        glVertex3f(0.4850, 0.0393, -0.5830);
-        glVertex3f(0.4850, -0.0450, -0.5102);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0081, -0.4250, -0.9051);
-        glVertex3f(0.4850, 0.0393, -0.5830);
-        glVertex3f(0.2729, -0.0800, -0.5289);
-        glVertex3f(0.2729, 0.1400, -0.6322);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0564, -0.0050, 1.6304);
-        glVertex3f(0.0000, -0.0050, 1.8147);
-        glVertex3f(0.0625, -0.0050, 1.8147);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0000, -0.0050, 1.8147);
-        glVertex3f(0.0564, -0.0050, 1.6304);
-        glVertex3f(0.0000, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9671, -0.2543);
-        glVertex3f(0.0417, -0.0300, 1.5353);
-        glVertex3f(0.0000, -0.0050, 1.6304);
-        glVertex3f(0.0564, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9671, -0.2543);
-        glVertex3f(0.0000, -0.0050, 1.6304);
-        glVertex3f(0.0417, -0.0300, 1.5353);
-        glVertex3f(0.0000, -0.0300, 1.5353);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9908, 0.1353);
-        glVertex3f(0.2479, 0.1700, -0.1745);
-        glVertex3f(0.0000, 0.1150, 0.2282);
-        glVertex3f(0.1183, 0.1150, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9908, 0.1353);
-        glVertex3f(0.0000, 0.1150, 0.2282);
-        glVertex3f(0.2479, 0.1700, -0.1745);
-        glVertex3f(0.0000, 0.1700, -0.1745);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1960, 0.1700, -0.5762);
-        glVertex3f(0.0000, 0.1700, -0.1745);
-        glVertex3f(0.2479, 0.1700, -0.1745);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0000, 0.1700, -0.1745);
-        glVertex3f(0.1960, 0.1700, -0.5762);
-        glVertex3f(0.0000, 0.1700, -0.5762);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.0000, 1.0000);
-        glVertex3f(0.1278, 0.0150, 0.2831);
-        glVertex3f(0.1944, -0.0250, 0.2831);
-        glVertex3f(0.1944, 0.0150, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.0000, 1.0000);
-        glVertex3f(0.1944, -0.0250, 0.2831);
-        glVertex3f(0.1278, 0.0150, 0.2831);
-        glVertex3f(0.1278, -0.0250, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0591, -0.9982, 0.0122);
-        glVertex3f(0.1278, 0.0150, 0.2831);
-        glVertex3f(0.1944, 0.0150, 0.6064);
-        glVertex3f(0.1278, 0.0200, 0.6926);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.1944, 0.0150, 0.6064);
-        glVertex3f(0.1278, 0.0150, 0.2831);
-        glVertex3f(0.1944, 0.0150, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-1.0000, 0.0000, 0.0000);
-        glVertex3f(0.1944, -0.0250, 0.2831);
-        glVertex3f(0.1944, 0.0150, 0.6064);
-        glVertex3f(0.1944, 0.0150, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-1.0000, 0.0000, -0.0000);
-        glVertex3f(0.1944, 0.0150, 0.6064);
-        glVertex3f(0.1944, -0.0250, 0.2831);
-        glVertex3f(0.1944, -0.0250, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1944, -0.0250, 0.2831);
-        glVertex3f(0.1278, -0.0250, 0.6926);
-        glVertex3f(0.1944, -0.0250, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1278, -0.0250, 0.6926);
-        glVertex3f(0.1944, -0.0250, 0.2831);
-        glVertex3f(0.1278, -0.0250, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(1.0000, 0.0000, 0.0000);
-        glVertex3f(0.1278, -0.0250, 0.6926);
-        glVertex3f(0.1278, 0.0150, 0.2831);
-        glVertex3f(0.1278, 0.0200, 0.6926);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(1.0000, 0.0000, -0.0000);
-        glVertex3f(0.1278, 0.0150, 0.2831);
-        glVertex3f(0.1278, -0.0250, 0.6926);
-        glVertex3f(0.1278, -0.0250, 0.2831);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.7911, 0.0000, 0.6117);
-        glVertex3f(0.1278, 0.0200, 0.6926);
-        glVertex3f(0.2000, 0.0200, 0.5992);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.7911, -0.0001, 0.6117);
-        glVertex3f(0.2000, 0.0200, 0.5992);
-        glVertex3f(0.1278, 0.0200, 0.6926);
-        glVertex3f(0.1944, 0.0150, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.7910, 0.0000, 0.6118);
-        glVertex3f(0.1944, -0.0250, 0.6064);
-        glVertex3f(0.2000, 0.0200, 0.5992);
-        glVertex3f(0.1944, 0.0150, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.7910, -0.0000, 0.6118);
-        glVertex3f(0.2000, 0.0200, 0.5992);
-        glVertex3f(0.1944, -0.0250, 0.6064);
-        glVertex3f(0.2000, -0.0300, 0.5992);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.7911, 0.0001, 0.6117);
-        glVertex3f(0.1278, -0.0250, 0.6926);
-        glVertex3f(0.2000, -0.0300, 0.5992);
-        glVertex3f(0.1944, -0.0250, 0.6064);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.7911, -0.0000, 0.6117);
-        glVertex3f(0.2000, -0.0300, 0.5992);
-        glVertex3f(0.1278, -0.0250, 0.6926);
-        glVertex3f(0.1111, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.7911, 0.0000, 0.6117);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glVertex3f(0.1278, -0.0250, 0.6926);
-        glVertex3f(0.1278, 0.0200, 0.6926);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.7911, 0.0000, 0.6117);
-        glVertex3f(0.1278, -0.0250, 0.6926);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glVertex3f(0.1111, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.9831, 0.0000, 0.1833);
-        glVertex3f(0.2250, -0.0450, 0.2282);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.2250, 0.1000, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.9839, -0.0090, 0.1786);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.2250, -0.0450, 0.2282);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.9977, 0.0000, 0.0672);
-        glVertex3f(0.2000, -0.0300, 0.5992);
-        glVertex3f(0.2250, 0.1000, 0.2282);
-        glVertex3f(0.2000, 0.0200, 0.5992);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.9977, -0.0000, 0.0672);
-        glVertex3f(0.2250, 0.1000, 0.2282);
-        glVertex3f(0.2000, -0.0300, 0.5992);
-        glVertex3f(0.2250, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.1731, 0.9644, 0.2001);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.1414, 0.1150, 0.2282);
-        glVertex3f(0.2250, 0.1000, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9935, 0.1138);
-        glVertex3f(0.1414, -0.0450, 0.2282);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glVertex3f(0.2250, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.4296, 0.8763, 0.2179);
-        glVertex3f(0.2250, 0.1000, 0.2282);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glVertex3f(0.2000, 0.0200, 0.5992);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.1741, 0.9699, 0.1705);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glVertex3f(0.2250, 0.1000, 0.2282);
-        glVertex3f(0.1414, 0.1150, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0897, -0.9956, 0.0261);
-        glVertex3f(0.1414, -0.0450, 0.2282);
-        glVertex3f(0.2000, -0.0300, 0.5992);
-        glVertex3f(0.1111, -0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9992, 0.0404);
-        glVertex3f(0.2000, -0.0300, 0.5992);
-        glVertex3f(0.1414, -0.0450, 0.2282);
-        glVertex3f(0.2250, -0.0450, 0.2282);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.0000, 1.0000);
-        glVertex3f(0.0000, -0.0850, 2.0741);
-        glVertex3f(0.0417, -0.1050, 2.0741);
-        glVertex3f(0.0417, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.0000, 1.0000);
-        glVertex3f(0.0417, -0.1050, 2.0741);
-        glVertex3f(0.0000, -0.0850, 2.0741);
-        glVertex3f(0.0000, -0.1050, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9556, 0.2946);
-        glVertex3f(0.0625, -0.0050, 1.8147);
-        glVertex3f(0.0000, -0.0850, 2.0741);
-        glVertex3f(0.0417, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9556, 0.2946);
-        glVertex3f(0.0000, -0.0850, 2.0741);
-        glVertex3f(0.0625, -0.0050, 1.8147);
-        glVertex3f(0.0000, -0.0050, 1.8147);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9940, 0.1098);
-        glVertex3f(0.0000, -0.1400, 1.7572);
-        glVertex3f(0.0417, -0.1050, 2.0741);
-        glVertex3f(0.0000, -0.1050, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9940, 0.1098);
-        glVertex3f(0.0417, -0.1050, 2.0741);
-        glVertex3f(0.0000, -0.1400, 1.7572);
-        glVertex3f(0.0625, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9931, -0.1175);
-        glVertex3f(0.0000, -0.1250, 1.6304);
-        glVertex3f(0.0625, -0.1400, 1.7572);
-        glVertex3f(0.0000, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9931, -0.1175);
-        glVertex3f(0.0625, -0.1400, 1.7572);
-        glVertex3f(0.0000, -0.1250, 1.6304);
-        glVertex3f(0.0564, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.0000, 1.0000);
-        glVertex3f(0.0417, -0.0850, 2.0741);
-        glVertex3f(0.0542, -0.1050, 2.0741);
-        glVertex3f(0.0542, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.0000, 1.0000);
-        glVertex3f(0.0542, -0.1050, 2.0741);
-        glVertex3f(0.0417, -0.0850, 2.0741);
-        glVertex3f(0.0417, -0.1050, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9556, 0.2946);
-        glVertex3f(0.1250, -0.0050, 1.8147);
-        glVertex3f(0.0417, -0.0850, 2.0741);
-        glVertex3f(0.0542, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9556, 0.2946);
-        glVertex3f(0.0417, -0.0850, 2.0741);
-        glVertex3f(0.1250, -0.0050, 1.8147);
-        glVertex3f(0.0625, -0.0050, 1.8147);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9647, 0.0000, 0.2633);
-        glVertex3f(0.0542, -0.1050, 2.0741);
-        glVertex3f(0.1250, -0.0050, 1.8147);
-        glVertex3f(0.0542, -0.0850, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9690, -0.0968, 0.2272);
-        glVertex3f(0.1250, -0.0050, 1.8147);
-        glVertex3f(0.0542, -0.1050, 2.0741);
-        glVertex3f(0.1250, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9940, 0.1098);
-        glVertex3f(0.0625, -0.1400, 1.7572);
-        glVertex3f(0.0542, -0.1050, 2.0741);
-        glVertex3f(0.0417, -0.1050, 2.0741);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9940, 0.1098);
-        glVertex3f(0.0542, -0.1050, 2.0741);
-        glVertex3f(0.0625, -0.1400, 1.7572);
-        glVertex3f(0.1250, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9877, 0.0000, -0.1563);
-        glVertex3f(0.1250, -0.0050, 1.8147);
-        glVertex3f(0.0958, -0.1250, 1.6304);
-        glVertex3f(0.0958, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9728, 0.0907, -0.2131);
-        glVertex3f(0.0958, -0.1250, 1.6304);
-        glVertex3f(0.1250, -0.0050, 1.8147);
-        glVertex3f(0.1250, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0958, -0.0050, 1.6304);
-        glVertex3f(0.0625, -0.0050, 1.8147);
-        glVertex3f(0.1250, -0.0050, 1.8147);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0625, -0.0050, 1.8147);
-        glVertex3f(0.0958, -0.0050, 1.6304);
-        glVertex3f(0.0564, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9931, -0.1175);
-        glVertex3f(0.0564, -0.1250, 1.6304);
-        glVertex3f(0.1250, -0.1400, 1.7572);
-        glVertex3f(0.0625, -0.1400, 1.7572);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9931, -0.1175);
-        glVertex3f(0.1250, -0.1400, 1.7572);
-        glVertex3f(0.0564, -0.1250, 1.6304);
-        glVertex3f(0.0958, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9671, -0.2543);
-        glVertex3f(0.0500, -0.0300, 1.5353);
-        glVertex3f(0.0564, -0.0050, 1.6304);
-        glVertex3f(0.0958, -0.0050, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, 0.9671, -0.2543);
-        glVertex3f(0.0564, -0.0050, 1.6304);
-        glVertex3f(0.0500, -0.0300, 1.5353);
-        glVertex3f(0.0417, -0.0300, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9008, 0.0000, -0.4342);
-        glVertex3f(0.0958, -0.0050, 1.6304);
-        glVertex3f(0.0500, -0.1000, 1.5353);
-        glVertex3f(0.0500, -0.0300, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.9008, 0.0000, -0.4342);
-        glVertex3f(0.0500, -0.1000, 1.5353);
-        glVertex3f(0.0958, -0.0050, 1.6304);
-        glVertex3f(0.0958, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9671, -0.2543);
-        glVertex3f(0.0417, -0.1000, 1.5353);
-        glVertex3f(0.0958, -0.1250, 1.6304);
-        glVertex3f(0.0564, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9671, -0.2543);
-        glVertex3f(0.0958, -0.1250, 1.6304);
-        glVertex3f(0.0417, -0.1000, 1.5353);
-        glVertex3f(0.0500, -0.1000, 1.5353);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9671, -0.2543);
-        glVertex3f(0.0000, -0.1000, 1.5353);
-        glVertex3f(0.0564, -0.1250, 1.6304);
-        glVertex3f(0.0000, -0.1250, 1.6304);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9671, -0.2543);
-        glVertex3f(0.0564, -0.1250, 1.6304);
-        glVertex3f(0.0000, -0.1000, 1.5353);
-        glVertex3f(0.0417, -0.1000, 1.5353);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9908, 0.1355);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.1183, 0.1150, 0.2282);
-        glVertex3f(0.1414, 0.1150, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0011, 0.9908, 0.1350);
-        glVertex3f(0.1183, 0.1150, 0.2282);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.2479, 0.1700, -0.1745);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9935, 0.1138);
-        glVertex3f(0.1183, -0.0450, 0.2282);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glVertex3f(0.1414, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0013, -0.9934, 0.1145);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glVertex3f(0.1183, -0.0450, 0.2282);
-        glVertex3f(0.2479, -0.0800, -0.0769);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9935, 0.1140);
-        glVertex3f(0.0000, -0.0800, -0.0769);
-        glVertex3f(0.1183, -0.0450, 0.2282);
-        glVertex3f(0.0000, -0.0450, 0.2282);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.9935, 0.1140);
-        glVertex3f(0.1183, -0.0450, 0.2282);
-        glVertex3f(0.0000, -0.0800, -0.0769);
-        glVertex3f(0.2479, -0.0800, -0.0769);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0010, 1.0000, 0.0001);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.1960, 0.1700, -0.5762);
-        glVertex3f(0.2479, 0.1700, -0.1745);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.3105, 0.9471, -0.0806);
-        glVertex3f(0.1960, 0.1700, -0.5762);
-        glVertex3f(0.3000, 0.1700, -0.1744);
-        glVertex3f(0.2729, 0.1400, -0.6322);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0016, -1.0000, -0.0002);
-        glVertex3f(0.1960, -0.0800, -0.4729);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glVertex3f(0.2479, -0.0800, -0.0769);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0001, -1.0000, 0.0001);
-        glVertex3f(0.2801, -0.0799, -0.0768);
-        glVertex3f(0.1960, -0.0800, -0.4729);
-        glVertex3f(0.2729, -0.0800, -0.5289);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -1.0000, -0.0000);
-        glVertex3f(0.0000, -0.0800, -0.4729);
-        glVertex3f(0.2479, -0.0800, -0.0769);
-        glVertex3f(0.0000, -0.0800, -0.0769);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.2479, -0.0800, -0.0769);
-        glVertex3f(0.0000, -0.0800, -0.4729);
-        glVertex3f(0.1960, -0.0800, -0.4729);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.2090, 0.9522, -0.2229);
-        glVertex3f(0.1980, 0.1400, -0.7024);
-        glVertex3f(0.1960, 0.1700, -0.5762);
-        glVertex3f(0.2729, 0.1400, -0.6322);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.9729, -0.2312);
-        glVertex3f(0.1960, 0.1700, -0.5762);
-        glVertex3f(0.1980, 0.1400, -0.7024);
-        glVertex3f(0.1540, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.8273, -0.2388, -0.5085);
-        glVertex3f(0.1980, 0.0300, -0.7024);
-        glVertex3f(0.2729, 0.1400, -0.6322);
-        glVertex3f(0.2729, -0.0800, -0.5289);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.6840, 0.0000, -0.7295);
-        glVertex3f(0.2729, 0.1400, -0.6322);
-        glVertex3f(0.1980, 0.0300, -0.7024);
-        glVertex3f(0.1980, 0.1400, -0.7024);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(-0.2726, -0.8861, -0.3748);
-        glVertex3f(0.1540, 0.0300, -0.7024);
-        glVertex3f(0.2729, -0.0800, -0.5289);
-        glVertex3f(0.1960, -0.0800, -0.4729);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.8447, -0.5353);
-        glVertex3f(0.2729, -0.0800, -0.5289);
-        glVertex3f(0.1540, 0.0300, -0.7024);
-        glVertex3f(0.1980, 0.0300, -0.7024);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9018, -0.4321);
-        glVertex3f(0.0000, 0.0300, -0.7024);
-        glVertex3f(0.1960, -0.0800, -0.4729);
-        glVertex3f(0.0000, -0.0800, -0.4729);
-        glColor3f(1.0000, 1.0000, 1.0000);
-        glNormal3f(0.0000, -0.9018, -0.4321);
-        glVertex3f(0.1960, -0.0800, -0.4729);
-        glVertex3f(0.0000, 0.0300, -0.7024);
-        glVertex3f(0.1540, 0.0300, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.9729, -0.2312);
-        glVertex3f(0.1540, 0.1400, -0.7024);
-        glVertex3f(0.0000, 0.1700, -0.5762);
-        glVertex3f(0.1960, 0.1700, -0.5762);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.9729, -0.2312);
-        glVertex3f(0.0000, 0.1700, -0.5762);
-        glVertex3f(0.1540, 0.1400, -0.7024);
-        glVertex3f(0.0000, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1980, 0.1400, -0.7713);
-        glVertex3f(0.1540, 0.1400, -0.7024);
-        glVertex3f(0.1980, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1540, 0.1400, -0.7024);
-        glVertex3f(0.1980, 0.1400, -0.7713);
-        glVertex3f(0.1540, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(1.0000, 0.0000, 0.0000);
-        glVertex3f(0.1980, 0.0300, -0.7024);
-        glVertex3f(0.1980, 0.1400, -0.7713);
-        glVertex3f(0.1980, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(1.0000, -0.0000, -0.0000);
-        glVertex3f(0.1980, 0.1400, -0.7713);
-        glVertex3f(0.1980, 0.0300, -0.7024);
-        glVertex3f(0.1980, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(0.1540, 0.0300, -0.7420);
-        glVertex3f(0.1980, 0.0300, -0.7024);
-        glVertex3f(0.1540, 0.0300, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.1980, 0.0300, -0.7024);
-        glVertex3f(0.1540, 0.0300, -0.7420);
-        glVertex3f(0.1980, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(0.0000, 0.0300, -0.7420);
-        glVertex3f(0.1540, 0.0300, -0.7024);
-        glVertex3f(0.0000, 0.0300, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.1540, 0.0300, -0.7024);
-        glVertex3f(0.0000, 0.0300, -0.7420);
-        glVertex3f(0.1540, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1540, 0.1400, -0.7713);
-        glVertex3f(0.0000, 0.1400, -0.7024);
-        glVertex3f(0.1540, 0.1400, -0.7024);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0000, 0.1400, -0.7024);
-        glVertex3f(0.1540, 0.1400, -0.7713);
-        glVertex3f(0.0000, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -0.7345, -0.6786);
-        glVertex3f(0.1540, 0.1400, -0.7713);
-        glVertex3f(0.1760, 0.1200, -0.7497);
-        glVertex3f(0.1430, 0.1200, -0.7497);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -0.7345, -0.6786);
-        glVertex3f(0.1760, 0.1200, -0.7497);
-        glVertex3f(0.1540, 0.1400, -0.7713);
-        glVertex3f(0.1980, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.5789, -0.2101, -0.7879);
-        glVertex3f(0.1760, 0.0500, -0.7311);
-        glVertex3f(0.1980, 0.1400, -0.7713);
-        glVertex3f(0.1980, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.5837, -0.2077, -0.7850);
-        glVertex3f(0.1980, 0.1400, -0.7713);
-        glVertex3f(0.1760, 0.0500, -0.7311);
-        glVertex3f(0.1760, 0.1200, -0.7497);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.4762, -0.8794);
-        glVertex3f(0.1540, 0.0300, -0.7420);
-        glVertex3f(0.1760, 0.0500, -0.7311);
-        glVertex3f(0.1980, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.4762, -0.8794);
-        glVertex3f(0.1760, 0.0500, -0.7311);
-        glVertex3f(0.1540, 0.0300, -0.7420);
-        glVertex3f(0.1430, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.4762, -0.8794);
-        glVertex3f(0.0000, 0.0300, -0.7420);
-        glVertex3f(0.1430, 0.0500, -0.7311);
-        glVertex3f(0.1540, 0.0300, -0.7420);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 0.4762, -0.8794);
-        glVertex3f(0.1430, 0.0500, -0.7311);
-        glVertex3f(0.0000, 0.0300, -0.7420);
-        glVertex3f(0.0000, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -0.7345, -0.6786);
-        glVertex3f(0.0000, 0.1400, -0.7713);
-        glVertex3f(0.1430, 0.1200, -0.7497);
-        glVertex3f(0.0000, 0.1200, -0.7497);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -0.7345, -0.6786);
-        glVertex3f(0.1430, 0.1200, -0.7497);
-        glVertex3f(0.0000, 0.1400, -0.7713);
-        glVertex3f(0.1540, 0.1400, -0.7713);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(0.1430, 0.1200, -0.7497);
-        glVertex3f(0.1760, 0.1200, -0.4614);
-        glVertex3f(0.1430, 0.1200, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.1760, 0.1200, -0.4614);
-        glVertex3f(0.1430, 0.1200, -0.7497);
-        glVertex3f(0.1760, 0.1200, -0.7497);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-1.0000, 0.0000, 0.0000);
-        glVertex3f(0.1760, 0.0500, -0.7311);
-        glVertex3f(0.1760, 0.1200, -0.4614);
-        glVertex3f(0.1760, 0.1200, -0.7497);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-1.0000, 0.0000, -0.0000);
-        glVertex3f(0.1760, 0.1200, -0.4614);
-        glVertex3f(0.1760, 0.0500, -0.7311);
-        glVertex3f(0.1760, 0.0500, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1760, 0.0500, -0.7311);
-        glVertex3f(0.1430, 0.0500, -0.4614);
-        glVertex3f(0.1760, 0.0500, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1430, 0.0500, -0.4614);
-        glVertex3f(0.1760, 0.0500, -0.7311);
-        glVertex3f(0.1430, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, 1.0000, 0.0000);
-        glVertex3f(0.1430, 0.0500, -0.7311);
-        glVertex3f(0.0000, 0.0500, -0.4614);
-        glVertex3f(0.1430, 0.0500, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, 1.0000, 0.0000);
-        glVertex3f(0.0000, 0.0500, -0.4614);
-        glVertex3f(0.1430, 0.0500, -0.7311);
-        glVertex3f(0.0000, 0.0500, -0.7311);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(0.0000, -1.0000, 0.0000);
-        glVertex3f(0.0000, 0.1200, -0.7497);
-        glVertex3f(0.1430, 0.1200, -0.4614);
-        glVertex3f(0.0000, 0.1200, -0.4614);
-        glColor3f(0.2706, 0.5255, 0.4549);
-        glNormal3f(-0.0000, -1.0000, 0.0000);
-        glVertex3f(0.1430, 0.1200, -0.4614);
-        glVertex3f(0.0000, 0.1200, -0.7497);
-        glVertex3f(0.1430, 0.1200, -0.7497);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.0000, -1.0000);
-        glVertex3f(0.1430, 0.0500, -0.4614);
-        glVertex3f(0.1760, 0.1200, -0.4614);
-        glVertex3f(0.1760, 0.0500, -0.4614);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(-0.0000, 0.0000, -1.0000);
-        glVertex3f(0.1430, 0.0500, -0.4614);
-        glVertex3f(0.1430, 0.1200, -0.4614);
-        glVertex3f(0.1760, 0.1200, -0.4614);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.0000, -1.0000);
-        glVertex3f(0.0000, 0.0500, -0.4614);
-        glVertex3f(0.1430, 0.1200, -0.4614);
-        glVertex3f(0.1430, 0.0500, -0.4614);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, -0.0000, -1.0000);
-        glVertex3f(0.1430, 0.1200, -0.4614);
-        glVertex3f(0.0000, 0.0500, -0.4614);
-        glVertex3f(0.0000, 0.1200, -0.4614);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9867, 0.1624);
-        glVertex3f(0.1414, 0.1150, 0.2282);
-        glVertex3f(0.0933, 0.0350, 0.7142);
-        glVertex3f(0.1111, 0.0350, 0.7142);
-        glColor3f(0.9333, 0.5020, 0.9333);
-        glNormal3f(0.0000, 0.9867, 0.1624);
-        glVertex3f(0.0933, 0.0350, 0.7142);
-        glVertex3f(0.1414, 0.1150, 0.2282);
-        glVertex3f(0.1183, 0.1150, 0.2282);
-        glEnd();
-        glEndList();
-    }
-}
-
-#endif
\ No newline at end of file
@@ -0,0 +1,194 @@
+#ifndef __SOLAR_SYSTEM_SPHERE_MESH_H
+#define __SOLAR_SYSTEM_SPHERE_MESH_H
+
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstddef>
+
+#include "gl_platform.h"
+
+#include "math3d.h"
+#include "vertex_stream.h"
+#include "instance_batch.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Unit sphere tessellated once into an indexed triangle list, laid
+	 * out like gluSphere(): poles on z, texture s around and t from the
+	 * bottom pole up. On a unit sphere the normal is the position, so
+	 * both arrays point at the same floats.
+	 *
+	 * Kept in static vertex and index buffers when GL has them, plain
+	 * client arrays otherwise. Many copies can go through an
+	 * instance_renderer.
+	 */
+	class sphere_mesh : public instanced_mesh {
+	public:
+		sphere_mesh(int slices, int stacks, bool textured):
+			textured(textured),
+			stride(textured ? 5 : 3) {
+			build(slices, stacks);
+		}
+
+		/**
+		 * Draw the sphere at the current transform scaled to "radius"
+		 */
+		void draw(float radius) {
+			glPushMatrix();
+			glPushAttrib(GL_ENABLE_BIT); {
+				glScalef(radius, radius, radius);
+				// the unit normals are scaled along with the sphere
+				glEnable(GL_NORMALIZE);
+				bind();
+				draw_bound();
+				unbind();
+			} glPopAttrib();
+			glPopMatrix();
+		}
+
+		/**
+		 * Point the vertex, normal and texture arrays at the mesh, for
+		 * any number of draw_bound() calls until unbind()
+		 */
+		void bind() {
+			buffers.bind(&vertices[0], vertices.size() * sizeof(float), &indices[0], indices.size() * sizeof(GLuint));
+			const GLsizei bytes = static_cast<GLsizei>(stride * sizeof(float));
+			glEnableClientState(GL_VERTEX_ARRAY);
+			glEnableClientState(GL_NORMAL_ARRAY);
+			glVertexPointer(3, GL_FLOAT, bytes, buffers.vertex_data(0));
+			glNormalPointer(GL_FLOAT, bytes, buffers.vertex_data(0));
+			if (textured) {
+				glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+				glTexCoordPointer(2, GL_FLOAT, bytes, buffers.vertex_data(3 * sizeof(float)));
+			}
+		}
+
+		/**
+		 * One unit sphere at the current transform, between bind() and unbind()
+		 */
+		void draw_bound() const {
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, buffers.index_data());
+		}
+
+		/**
+		 * "count" spheres in one call, between bind() and unbind(), each
+		 * placed by the per-instance attributes set up by the caller
+		 */
+		void draw_bound_instanced(GLsizei count) const {
+			glDrawElementsInstancedARB(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, buffers.index_data(), count);
+		}
+
+		bool can_instance() const {
+			return true;
+		}
+
+		void unbind() {
+			if (textured) {
+				glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+			}
+			glDisableClientState(GL_NORMAL_ARRAY);
+			glDisableClientState(GL_VERTEX_ARRAY);
+			buffers.unbind();
+		}
+
+		size_t get_vertex_count() const {
+			return vertices.size() / stride;
+		}
+
+		size_t get_triangle_count() const {
+			return indices.size() / 3;
+		}
+
+	private:
+		void build(int slices, int stacks) {
+			const float drho = constants::PI / stacks;
+			const float dtheta = 2.0f * constants::PI / slices;
+			vertices.reserve((stacks + 1) * (slices + 1) * stride);
+			for (int i = 0; i <= stacks; ++i) {
+				const float rho = i * drho;
+				for (int j = 0; j <= slices; ++j) {
+					// the seam repeats the first column with s = 1
+					const float theta = (j == slices) ? 0.0f : j * dtheta;
+					vertices.push_back(-sinf(theta) * sinf(rho));
+					vertices.push_back(cosf(theta) * sinf(rho));
+					vertices.push_back(cosf(rho));
+					if (textured) {
+						vertices.push_back(static_cast<float>(j) / slices);
+						vertices.push_back(1.0f - static_cast<float>(i) / stacks);
+					}
+				}
+			}
+			// two counter-clockwise triangles per quad, facing out; the
+			// quads touching a pole collapse to one
+			indices.reserve(stacks * slices * 6);
+			for (int i = 0; i < stacks; ++i) {
+				for (int j = 0; j < slices; ++j) {
+					const GLuint a = i * (slices + 1) + j;
+					const GLuint b = a + slices + 1;
+					if (i != stacks - 1) {
+						indices.push_back(a);
+						indices.push_back(b);
+						indices.push_back(b + 1);
+					}
+					if (i != 0) {
+						indices.push_back(a);
+						indices.push_back(b + 1);
+						indices.push_back(a + 1);
+					}
+				}
+			}
+		}
+
+	private:
+		bool textured;
+		size_t stride;			// floats per vertex
+		vector<float> vertices;	// x, y, z and s, t when textured
+		vector<GLuint> indices;
+		static_buffers buffers;
+	};
+
+	/**
+	 * One sphere_mesh per (slices, stacks, textured), built the first
+	 * time it is asked for and kept for the life of the program
+	 */
+	class sphere_cache {
+	public:
+		static sphere_mesh &get(int slices, int stacks, bool textured) {
+			static map<key, sphere_mesh *> meshes;
+			const key k(slices, stacks, textured);
+			map<key, sphere_mesh *>::iterator it = meshes.find(k);
+			if (it == meshes.end()) {
+				it = meshes.insert(make_pair(k, new sphere_mesh(slices, stacks, textured))).first;
+			}
+			return *it->second;
+		}
+
+	private:
+		struct key {
+			int slices;
+			int stacks;
+			bool textured;
+
+			key(int slices, int stacks, bool textured):
+				slices(slices),
+				stacks(stacks),
+				textured(textured) {
+			}
+
+			bool operator <(const key &o) const {
+				if (slices != o.slices) {
+					return slices < o.slices;
+				}
+				if (stacks != o.stacks) {
+					return stacks < o.stacks;
+				}
+				return textured < o.textured;
+			}
+		};
+	};
+}
+
+#endif
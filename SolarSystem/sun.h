@@ -1,9 +1,7 @@
 #ifndef SUN_H
 #define SUN_H
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "object3d.h"
 #include "drawable.h"
@@ -11,6 +9,10 @@
 #include "image.h"
 #include "torpedo.h"
 #include "spaceship.h"
+#include "planet.h"
+#include "sphere_mesh.h"
+#include "screen_lod.h"
+#include "gl_state.h"
 
 using namespace std;
 
@@ -18,9 +20,13 @@ class sun :
 public object3d,
 public drawable {
 
+public:
+    /* the sun is drawn with a radius of 2000 whatever its collision radius */
+    static constexpr float DRAW_RADIUS = 2000.0f;
+
 public:
     sun()
-    :MAX_LENGTH(200.0), MAX_FORCE(18.0) {
+    :MAX_LENGTH(200.0), MAX_FORCE(18.0), lod(planet::get_lod_levels(), planet::LOD_COUNT) {
     }
 
     sun(const string &name, float radius, unsigned tid):
@@ -28,7 +34,8 @@ public:
     texture_on(true),
     radius(radius),
     MAX_LENGTH(200.0),
-    MAX_FORCE(18.0) {
+    MAX_FORCE(18.0),
+    lod(planet::get_lod_levels(), planet::LOD_COUNT) {
 
         angle = 0.0f;
         bounding_sphere = false;
@@ -37,10 +44,6 @@ public:
         gravity_on = false;
 
         texture_id = tid;
-        sphere = gluNewQuadric();
-        gluQuadricDrawStyle(sphere, GLU_FILL);
-        gluQuadricTexture(sphere, GL_TRUE);
-        gluQuadricNormals(sphere, GLU_SMOOTH);
 
         yaw = angle;
         rotate_about = false;
@@ -54,27 +57,29 @@ public:
         this->sp = *sp;
     }
 
-    void apply_texture() {
-        glColor3fv(get_color(colors::yellow));
-        if (texture_on) {
-            glEnable(GL_TEXTURE_2D);
-            glBindTexture(GL_TEXTURE_2D, texture_id);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        } else {
-            glDisable(GL_TEXTURE_2D);
-        }
+    /**
+     * Texture and lighting draw() expects to be set up for it
+     */
+    util::render_state get_render_state() const {
+        return util::render_state(texture_on ? texture_id : 0);
+    }
+
+    /**
+     * Radius of everything draw() puts on screen
+     */
+    float get_draw_radius() const {
+        return (bounding_sphere_radius > DRAW_RADIUS) ? bounding_sphere_radius : DRAW_RADIUS;
     }
 
     void draw() {
         glPushMatrix();
         {
-            // set texture
-            apply_texture();
+            glColor3fv(get_color(colors::yellow));
             // update
-            glMultMatrixf(OM);
+            glMultMatrixf(RM);
             // draw it
-            gluSphere(sphere, 2000.0, 200, 40);
+            const util::lod_level &level = lod.select_for_radius(DRAW_RADIUS);
+            util::sphere_cache::get(level.slices, level.stacks, true).draw(DRAW_RADIUS);
             // bounding sphere
             object3d::draw();
             // draw gravity
@@ -137,12 +142,13 @@ private:
     bool texture_on;
     bool gravity_on;
     float radius;
-    GLUquadricObj *sphere;
     image *img;
     unsigned texture_id;
     float angle;
     vector<torpedo **> affected_objects;
     spaceship *sp;
+    /* levels shared with the planets */
+    util::lod_selector lod;
 };
 
 #endif
\ No newline at end of file
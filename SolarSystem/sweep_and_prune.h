@@ -0,0 +1,138 @@
+#ifndef __SOLAR_SYSTEM_SWEEP_AND_PRUNE_H
+#define __SOLAR_SYSTEM_SWEEP_AND_PRUNE_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "vector3.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Broadphase collision on one axis.
+	 *
+	 * Every collider is a bounding sphere with a layer bit and a mask of
+	 * the layers it wants to be tested against. find_pairs() keeps the
+	 * colliders sorted by the low end of their x interval with an
+	 * insertion sort (objects move a little per step, so the order is
+	 * almost right and the sort is close to linear), sweeps along x and
+	 * returns only the pairs whose boxes overlap and whose layers interact.
+	 *
+	 * Pairs come out as (lower id, higher id) in increasing order, so
+	 * callers control the narrowphase order by the order of add().
+	 */
+	class sweep_and_prune {
+	public:
+		typedef pair<int, int> id_pair;
+
+	public:
+		/**
+		 * Register a collider, returns its id
+		 */
+		int add(unsigned layer, unsigned mask) {
+			entry e;
+			e.layer = layer;
+			e.mask = mask;
+			e.enabled = true;
+			for (int k = 0; k < 3; ++k) {
+				e.lo[k] = e.hi[k] = 0.0f;
+			}
+			entries.push_back(e);
+			order.push_back(static_cast<int>(entries.size() - 1));
+			return static_cast<int>(entries.size() - 1);
+		}
+
+		size_t size() const {
+			return entries.size();
+		}
+
+		/**
+		 * Move collider id to a new bounding sphere
+		 */
+		void set_sphere(int id, const vector3<float> &center, float radius) {
+			entry &e = entries[id];
+			for (int k = 0; k < 3; ++k) {
+				e.lo[k] = center[k] - radius;
+				e.hi[k] = center[k] + radius;
+			}
+		}
+
+		/**
+		 * Disabled colliders keep their slot but never show up in a pair
+		 */
+		void set_enabled(int id, bool value) {
+			entries[id].enabled = value;
+		}
+
+		/**
+		 * Potentially overlapping pairs for the current spheres
+		 */
+		const vector<id_pair> &find_pairs() {
+			sort_axis();
+			pairs.clear();
+			const size_t n = order.size();
+			for (size_t i = 0; i < n; ++i) {
+				const entry &a = entries[order[i]];
+				if (!a.enabled) {
+					continue;
+				}
+				for (size_t j = i + 1; j < n; ++j) {
+					const entry &b = entries[order[j]];
+					if (b.lo[0] > a.hi[0]) {
+						break;
+					}
+					if (!b.enabled || !interacts(a, b) || !overlaps(a, b)) {
+						continue;
+					}
+					const int p = order[i], q = order[j];
+					pairs.push_back(p < q ? id_pair(p, q) : id_pair(q, p));
+				}
+			}
+			sort(pairs.begin(), pairs.end());
+			return pairs;
+		}
+
+	private:
+		struct entry {
+			float lo[3];
+			float hi[3];
+			unsigned layer;
+			unsigned mask;
+			bool enabled;
+		};
+
+		static bool interacts(const entry &a, const entry &b) {
+			return (a.mask & b.layer) != 0 || (b.mask & a.layer) != 0;
+		}
+
+		static bool overlaps(const entry &a, const entry &b) {
+			return a.lo[1] <= b.hi[1] && b.lo[1] <= a.hi[1] &&
+				   a.lo[2] <= b.hi[2] && b.lo[2] <= a.hi[2];
+		}
+
+		/**
+		 * Insertion sort of order by lo[0], cheap when nearly sorted
+		 */
+		void sort_axis() {
+			for (size_t i = 1; i < order.size(); ++i) {
+				const int id = order[i];
+				const float key = entries[id].lo[0];
+				size_t j = i;
+				while (j > 0 && entries[order[j - 1]].lo[0] > key) {
+					order[j] = order[j - 1];
+					--j;
+				}
+				order[j] = id;
+			}
+		}
+
+	private:
+		vector<entry> entries;
+		vector<int> order;		// ids sorted by lo[0]
+		vector<id_pair> pairs;
+	};
+}
+
+#endif
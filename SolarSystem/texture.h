@@ -9,9 +9,7 @@
 #include <algorithm>
 #include <cassert>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 #include "image.h"
 
@@ -95,6 +93,9 @@ private:
                         pixels);
                 delete pixels;
             }
+            // filtering is part of the texture, set once here instead of per draw
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
             // insert into hash-map for later look up
             // we choose the first file name as key
             hm.insert(make_pair(filenames[i].first, texture_ids[i]));
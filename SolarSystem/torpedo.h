@@ -13,7 +13,11 @@
 #include "drawable.h"
 #include "movable.h"
 #include "object3d.h"
+#include "matrix4.h"
+#include "gravity_field.h"
 #include "colors.h"
+#include "explodable.h"
+#include "sphere_mesh.h"
 
 using namespace std;
 using namespace util;
@@ -44,7 +48,14 @@ private:
     operator T () const;
 };
 
-class torpedo : public object3d, public drawable, public movable {
+class torpedo : public object3d, public drawable, public movable, public explodable {
+
+public:
+    /* reach of the burst when a torpedo goes off */
+    static constexpr float EXPLOSION_RADIUS = 1000.0f;
+    /* tessellation of the body, the same for every torpedo */
+    static const int BODY_SLICES = 40;
+    static const int BODY_STACKS = 20;
 
 public:
     torpedo():
@@ -53,7 +64,6 @@ public:
     alive(false) {
 
         collidable = true;
-        explosion_radius = 1000;
         bounding_sphere_radius = radius + 10;
         lives = 1000;
     }
@@ -72,7 +82,6 @@ public:
         radius = 50;
         alive = true;
         counter = 0;
-        explosion_radius = 1000;
         collidable = true;
         gravity_on = false;
 
@@ -83,27 +92,17 @@ public:
         this->lives = lives;
     }
 
-    void draw_explosion() {
-        if (explosion_radius > 0) {
-            glColor3fv(get_color(colors::green));
-            glutSolidSphere(explosion_radius, 40, 20);
-            explosion_radius -= 50;
-        }
-    }
-
     void draw() {
         glPushMatrix();
         {
             // update
-            glMultMatrixf(OM);
+            glMultMatrixf(RM);
             // actual rendering
             if (alive) {
                 // draw_vector(get_forward(), colors::cyan);
                 // draw_vector((target - position).normal(), colors::yellow);
-                draw_itself(mtype);
+                draw_itself();
                 draw_vector(target - get_position(), colors::yellow);
-            } else {
-                draw_explosion();
             }
             // draw axes or bounding sphere
             object3d::draw();
@@ -111,22 +110,48 @@ public:
         glPopMatrix();
     }
 
-    void draw_itself(const torpedo_type &type) {
-        glColor3fv(get_color(color));
-        switch (type.t) {
-            case torpedo_type::AGM_84_HARPOON:
-                glutSolidSphere(50, 40, 20);
-                break;
-
-            case torpedo_type::AIM_4_FALCON:
-                glutSolidSphere(50, 40, 20);
-                break;
+    /**
+     * Queue the body as a copy of a cached sphere, draw_guides()
+     * draws the rest
+     */
+    void submit(util::instance_renderer &instances) {
+        if (alive) {
+            util::matrix4 model(RM);
+            model.scale(radius, radius, radius);
+            instances.add(get_body(), model, get_color(color));
+        }
+    }
+
+    /**
+     * Everything draw() puts around the body: the line to the target
+     * and the overlays
+     */
+    void draw_guides() {
+        glPushMatrix();
+        {
+            glMultMatrixf(RM);
+            if (alive) {
+                draw_vector(target - get_position(), colors::yellow);
+            }
+            object3d::draw();
         }
+        glPopMatrix();
+    }
+
+    /**
+     * The sphere every torpedo is drawn with
+     */
+    static util::sphere_mesh &get_body() {
+        return util::sphere_cache::get(BODY_SLICES, BODY_STACKS, false);
+    }
+
+    void draw_itself() {
+        glColor3fv(get_color(color));
+        // both types look the same for now
+        get_body().draw(radius);
     }
 
     void move() {
-        vector3<float> to_target = target - get_position();
-        to_target.normalize();
         position += (get_forward() * speed);
     }
 
@@ -136,15 +161,16 @@ public:
             if (counter <= lives) {
                 turn_toward();
             } else {
+                explode(get_position(), EXPLOSION_RADIUS, colors::green);
                 alive = false;
             }
         }
     }
 
-    double get_rotation_angle(vector3<float> u, vector3<float> v) const {
-        u.normalize();
-        v.normalize();
-        double cosine_theta = u.dot(v);
+    double get_rotation_angle(const vector3<float> &u, const vector3<float> &v) const {
+        vector3<float> uv[2] = { u, v };
+        math3d::normalize(uv, 2);
+        double cosine_theta = uv[0].dot(uv[1]);
         // domain of arccosine is [-1, 1]
         if (cosine_theta > 1) {
             cosine_theta = 1;
@@ -155,9 +181,11 @@ public:
         return math3d::to_degree(acos(cosine_theta));
     }
 
-    vector3<float> get_rotation_axis(vector3<float> u, vector3<float> v) const {
-        u.normalize();
-        v.normalize();
+    vector3<float> get_rotation_axis(const vector3<float> &a, const vector3<float> &b) const {
+        vector3<float> uv[2] = { a, b };
+        math3d::normalize(uv, 2);
+        vector3<float> &u = uv[0];
+        vector3<float> &v = uv[1];
         // fix linear case
         if (u == v || u == -v) {
             v[0] += 0.05;
@@ -169,22 +197,19 @@ public:
     }
 
     void turn_toward() {
-        vector3<float> to_target = (target - position);
-        glMatrixMode(GL_MODELVIEW);
-        glPushMatrix();
-        {
-            glLoadIdentity();
-            glTranslatef(position.get_x(), position.get_y(), position.get_z());
-            glRotatef(1.0f, 0, 1, 0);
-            glGetFloatv(GL_MODELVIEW_MATRIX, OM);
-        }
-        glPopMatrix();
+        // towards the target and along gravity, normalized together
+        vector3<float> directions[2] = { target - position, gravity_vector };
+        math3d::normalize(directions, gravity_on ? 2 : 1);
+        matrix4 m;
+        m.translate(position.get_x(), position.get_y(), position.get_z());
+        m.rotate_y(1.0f);
+        m.copy_to(OM);
         if (gravity_on) {
-            if (gravity_vector.length() != 0) {
-                position += (to_target.normal() + gravity_vector.normal()) * speed;
+            if (gravity_vector.dot(gravity_vector) != 0) {
+                position += (directions[0] + directions[1]) * speed;
             }
         } else {
-            position += (to_target.normal() * speed);
+            position += (directions[0] * speed);
         }
     }
 
@@ -197,15 +222,10 @@ public:
         } else {
             angle = -angle;
         }
-        glMatrixMode(GL_MODELVIEW);
-        glPushMatrix();
-        {
-            glLoadIdentity();
-            glTranslatef(position.get_x(), position.get_y(), position.get_z());
-            glRotatef(angle, axis.get_x(), axis.get_y(), axis.get_z());
-            glGetFloatv(GL_MODELVIEW_MATRIX, OM);
-        }
-        glPopMatrix();
+        matrix4 m;
+        m.translate(position.get_x(), position.get_y(), position.get_z());
+        m.rotate(angle, axis.get_x(), axis.get_y(), axis.get_z());
+        m.copy_to(OM);
         move();
     }
 
@@ -221,6 +241,9 @@ public:
     }
 
     void destroy() {
+        if (alive) {
+            explode(get_position(), EXPLOSION_RADIUS, colors::green);
+        }
         alive = false;
         counter = 0;
     }
@@ -235,6 +258,13 @@ public:
         gravity_vector = gravity;
     }
 
+    /**
+     * Query the pull at the torpedo's position from a gravity field
+     */
+    void apply_gravity(const util::gravity_field &field) {
+        apply_gravity(field.acceleration_at(position));
+    }
+
     void set_gravity(bool mode) {
         gravity_on = mode;
     }
@@ -276,7 +306,6 @@ private:
     int lives;
     int speed;
     int counter;
-    int explosion_radius;
     color_name color;
     torpedo_type mtype;
     vector3<float> target;
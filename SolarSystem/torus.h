@@ -12,6 +12,9 @@
 #include "math3d.h"
 #include "vector3.h"
 #import "drawable.h"
+#include "sphere_mesh.h"
+#include "torus_mesh.h"
+#include "screen_lod.h"
 
 using namespace std;
 using namespace colors;
@@ -24,13 +27,25 @@ class torus:
 
 public:
 	static const int OFFSET = 1000;
+	/* sides and rings of the tube from up close to a few pixels wide */
+	static const int LOD_COUNT = 3;
+
+	static const util::lod_level *get_lod_levels() {
+		static const util::lod_level levels[LOD_COUNT] = {
+			{ 40, 20, 60.0f },
+			{ 20, 12, 15.0f },
+			{ 10, 8, 0.0f }
+		};
+		return levels;
+	}
 
 public:
 	torus(const string &name = "torus", float radius = 1.0f, float degree = 1.0f, float p[3] = NULL, const color_name& c = green): 
 		object3d(name, radius, false, vector3<float>(p[0], p[1], p[2]), vector3<float>(0, 1, 0)),  
 		radius(radius), 
 		degree(degree),  
-		color(c) {
+		color(c),
+		lod(get_lod_levels(), LOD_COUNT) {
 		for (int i = 0; i < 3; ++i) {
 			position[i] = p[i];
 		}
@@ -40,41 +55,74 @@ public:
 	~torus() {
 	}
 
+	/**
+	 * The bounding volume is a fatter torus around the same ring
+	 */
 	void draw_bounding_sphere() {
-		double center = OFFSET + radius;
-		double diamater = (OFFSET + radius)*2;
-		int no_sphere = (diamater/radius) * 4;	
-		double angle = 0.0;
-		for (int i = 0; i < no_sphere; ++i) {
-			glPushMatrix(); {
-				glColor3fv(get_color(colors::white));
-				glTranslatef(center*cos(angle), center*sin(angle), 0);
-				glutWireSphere(bounding_sphere_radius, 40, 20);
-			} glPopMatrix();
-			angle += (2 * util::constants::PI) / no_sphere;
-		}
+		glColor3fv(get_color(colors::white));
+		glutWireTorus(bounding_sphere_radius, OFFSET + radius, 40, 20);
+	}
+
+	float get_enclosing_radius() const {
+		return OFFSET + radius + bounding_sphere_radius;
+	}
+
+	/**
+	 * Distance from p to the circle running through the middle of the
+	 * tube. The ring lies in the torus' xy plane around get_position().
+	 */
+	float distance_to_ring(const vector3<float> &p) const {
+		return sqrtf(distance_squared_to_ring(p));
+	}
+
+	/**
+	 * Same, squared, for overlap tests that need no square root
+	 */
+	float distance_squared_to_ring(const vector3<float> &p) const {
+		vector3<float> d = p - get_position();
+		float planar = sqrtf(d[0] * d[0] + d[1] * d[1]) - (OFFSET + radius);
+		return planar * planar + d[2] * d[2];
 	}
 
 	bool collide_with(const object3d *other) const {
-		double outer_radius = OFFSET + radius;
-		double diamater = (OFFSET + radius)*2;
-		int no_sphere = (diamater/radius) * 4;	
-		double angle = 0.0;
-		vector3<float> center;
-		for (int i = 0; i < no_sphere; ++i) {
-			center = get_position() + vector3<float>(outer_radius*cos(angle), outer_radius*sin(angle), 0.0f);
-			if (math3d::distance(center, other->get_position()) < (bounding_sphere_radius + other->get_bounding_sphere_radius())) {
+		float reach = bounding_sphere_radius + other->get_bounding_sphere_radius();
+		return distance_squared_to_ring(other->get_position()) < reach * reach;
+	}
+
+	/**
+	 * The torus never moves, so advance the other sphere along its path
+	 * by its clearance from the tube, which it cannot close any faster
+	 * (distance_to_ring() is 1-Lipschitz), and report the first overlap
+	 */
+	bool sweep_with(const object3d *other, float &toi) const {
+		vector3<float> from = other->get_previous_enclosing_center();
+		vector3<float> to = other->get_enclosing_center();
+		float reach = bounding_sphere_radius + other->get_bounding_sphere_radius();
+		float length = (to - from).length();
+		if (length <= 0.0f) {
+			toi = 1.0f;
+			return distance_squared_to_ring(to) < reach * reach;
+		}
+		vector3<float> direction = (to - from) * (1.0f / length);
+		// a path grazing the tube would otherwise creep along forever
+		const float min_step = reach * 1e-3f;
+		for (float s = 0.0f; ; ) {
+			float clearance = distance_to_ring(from + direction * s) - reach;
+			if (clearance < 0.0f) {
+				toi = s / length;
 				return true;
 			}
-			angle += (2 * util::constants::PI) / no_sphere;
+			if (s >= length) {
+				return false;
+			}
+			s = min(s + max(clearance, min_step), length);
 		}
-		return false;
 	}
 
 	void draw() {
 		glPushMatrix(); {
 			// update
-			glMultMatrixf(OM);
+			glMultMatrixf(RM);
 			// actual rendering	
 			draw_itself();
 			// draw bounding sphere
@@ -88,12 +136,14 @@ public:
 
 	void draw_itself() {
 		glColor3fv(get_color(color));
+		// the ring reaches OFFSET + 2 * radius out
+		const util::lod_level &level = lod.select_for_radius(OFFSET + 2 * radius);
 		if (is_solid()) {
-			glutSolidSphere(100, 40, 20);
-			glutSolidTorus(radius, radius + OFFSET, 40, 20);
+			util::sphere_cache::get(level.slices, level.stacks, false).draw(100);
+			util::torus_cache::get(level.slices, level.stacks, radius / (radius + OFFSET)).draw(radius + OFFSET);
 		} else {
-			glutWireSphere(100, 40, 20);
-			glutWireTorus(radius, radius + OFFSET, 40, 20);
+			glutWireSphere(100, level.slices, level.stacks);
+			glutWireTorus(radius, radius + OFFSET, level.slices, level.stacks);
 		}
 	}
 
@@ -105,6 +155,7 @@ private:
 	float radius;
 	float degree;
 	color_name color;
+	util::lod_selector lod;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+#ifndef __SOLAR_SYSTEM_TORUS_MESH_H
+#define __SOLAR_SYSTEM_TORUS_MESH_H
+
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstddef>
+
+#include "gl_platform.h"
+
+#include "math3d.h"
+#include "vertex_stream.h"
+#include "instance_batch.h"
+
+using namespace std;
+
+namespace util {
+	/**
+	 * Torus with a ring of radius 1 around z and a tube of radius
+	 * "tube", tessellated once into an indexed triangle list the way
+	 * glutSolidTorus() lays it out: "sides" around the tube and "rings"
+	 * around z. Scaling it by the ring radius gives glutSolidTorus(
+	 * tube * r, r, sides, rings).
+	 */
+	class torus_mesh : public instanced_mesh {
+	public:
+		torus_mesh(int sides, int rings, float tube) {
+			build(sides, rings, tube);
+		}
+
+		/**
+		 * Draw the torus at the current transform with a ring of "radius"
+		 */
+		void draw(float radius) {
+			glPushMatrix();
+			glPushAttrib(GL_ENABLE_BIT); {
+				glScalef(radius, radius, radius);
+				// the unit normals are scaled along with the torus
+				glEnable(GL_NORMALIZE);
+				bind();
+				draw_bound();
+				unbind();
+			} glPopAttrib();
+			glPopMatrix();
+		}
+
+		void bind() {
+			buffers.bind(&vertices[0], vertices.size() * sizeof(float), &indices[0], indices.size() * sizeof(GLuint));
+			const GLsizei bytes = static_cast<GLsizei>(6 * sizeof(float));
+			glEnableClientState(GL_VERTEX_ARRAY);
+			glEnableClientState(GL_NORMAL_ARRAY);
+			glVertexPointer(3, GL_FLOAT, bytes, buffers.vertex_data(0));
+			glNormalPointer(GL_FLOAT, bytes, buffers.vertex_data(3 * sizeof(float)));
+		}
+
+		void draw_bound() const {
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, buffers.index_data());
+		}
+
+		void draw_bound_instanced(GLsizei count) const {
+			glDrawElementsInstancedARB(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, buffers.index_data(), count);
+		}
+
+		bool can_instance() const {
+			return true;
+		}
+
+		void unbind() {
+			glDisableClientState(GL_NORMAL_ARRAY);
+			glDisableClientState(GL_VERTEX_ARRAY);
+			buffers.unbind();
+		}
+
+		size_t get_vertex_count() const {
+			return vertices.size() / 6;
+		}
+
+		size_t get_triangle_count() const {
+			return indices.size() / 3;
+		}
+
+	private:
+		void build(int sides, int rings, float tube) {
+			const float dphi = 2.0f * constants::PI / rings;
+			const float dtheta = 2.0f * constants::PI / sides;
+			vertices.reserve((rings + 1) * (sides + 1) * 6);
+			for (int i = 0; i <= rings; ++i) {
+				// the seams repeat the first ring and side
+				const float phi = (i == rings) ? 0.0f : i * dphi;
+				for (int j = 0; j <= sides; ++j) {
+					const float theta = (j == sides) ? 0.0f : j * dtheta;
+					const float nx = cosf(phi) * cosf(theta);
+					const float ny = sinf(phi) * cosf(theta);
+					const float nz = sinf(theta);
+					vertices.push_back(cosf(phi) + tube * nx);
+					vertices.push_back(sinf(phi) + tube * ny);
+					vertices.push_back(tube * nz);
+					vertices.push_back(nx);
+					vertices.push_back(ny);
+					vertices.push_back(nz);
+				}
+			}
+			// two counter-clockwise triangles per quad, facing out
+			indices.reserve(rings * sides * 6);
+			for (int i = 0; i < rings; ++i) {
+				for (int j = 0; j < sides; ++j) {
+					const GLuint a = i * (sides + 1) + j;
+					const GLuint b = a + sides + 1;
+					indices.push_back(a);
+					indices.push_back(b);
+					indices.push_back(b + 1);
+					indices.push_back(a);
+					indices.push_back(b + 1);
+					indices.push_back(a + 1);
+				}
+			}
+		}
+
+	private:
+		vector<float> vertices;	// x, y, z, nx, ny, nz
+		vector<GLuint> indices;
+		static_buffers buffers;
+	};
+
+	/**
+	 * One torus_mesh per (sides, rings, tube), built the first time it
+	 * is asked for and kept for the life of the program
+	 */
+	class torus_cache {
+	public:
+		static torus_mesh &get(int sides, int rings, float tube) {
+			static map<key, torus_mesh *> meshes;
+			const key k(sides, rings, tube);
+			map<key, torus_mesh *>::iterator it = meshes.find(k);
+			if (it == meshes.end()) {
+				it = meshes.insert(make_pair(k, new torus_mesh(sides, rings, tube))).first;
+			}
+			return *it->second;
+		}
+
+	private:
+		struct key {
+			int sides;
+			int rings;
+			float tube;
+
+			key(int sides, int rings, float tube):
+				sides(sides),
+				rings(rings),
+				tube(tube) {
+			}
+
+			bool operator <(const key &o) const {
+				if (sides != o.sides) {
+					return sides < o.sides;
+				}
+				if (rings != o.rings) {
+					return rings < o.rings;
+				}
+				return tube < o.tube;
+			}
+		};
+	};
+}
+
+#endif
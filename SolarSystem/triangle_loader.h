@@ -4,6 +4,8 @@
 #include <math.h>
 #include <stdio.h>
 
+#include "model_mesh.h"
+
 namespace util {
 
 // 3 vertices of triangle
@@ -52,25 +54,15 @@ namespace util {
         }
     }
 
-    void run() {
-        FILE *model;
+    /**
+     *  Read triangles from stdin, 9 coordinates and a hex colour each,
+     *  and write them as a model_mesh to "filename"
+     */
+    bool run(const char *filename = "warbird.mesh") {
         unsigned int c;
-        unsigned int red, green, blue;
+        unsigned char rgb[3];
         bool done = false;
-        model = fopen("special_model.h", "w");
-        // open output file for writing and write "header"
-        fprintf(model, "#ifndef SPECIAL_MODEL_H\n");
-        fprintf(model, "#define SPECIAL_MODEL_H\n");
-        fprintf(model, " \n");
-        fprintf(model, "#include <GL/glut.h>\n");
-        fprintf(model, "#include \"opengl_macro.h\"\n");
-        fprintf(model, "namespace special_model {\n");
-        fprintf(model, " \n");
-        fprintf(model, "void generate_spaceship_model(int list_id, float scale) {\n");
-        fprintf(model, "	gl_enable(GL_NORMALIZE);\n");
-        fprintf(model, "	gl_new_list(list_id, GL_COMPILE);\n");
-        fprintf(model, "	gl_scale_f(scale, scale, scale);\n");
-        fprintf(model, "	gl_begin(GL_TRIANGLES);\n");
+        model_mesh mesh;
         //read input from stdin.
         while (!feof(stdin)) {
             for (int i = 0; i < 3; i++)
@@ -85,33 +77,15 @@ namespace util {
             if (!done) {  // compute values
                 // read and process color values
                 fscanf(stdin, "%x", &c);
-                red = c;
-                green = c;
-                blue = c;
-                red = red >> 16;
-                green = green << 16;
-                green = green >> 24;
-                blue = blue << 24;
-                blue = blue >> 24;
-
-
-                fprintf(model, "	gl_color_3f(%9.4f, %9.4f, %9.4f);\n", red / 255.0, green / 255.0, blue / 255.0);
+                rgb[0] = (c >> 16) & 0xff;
+                rgb[1] = (c >> 8) & 0xff;
+                rgb[2] = c & 0xff;
                 compute_normals();  // computes 3 normals -- only use the first one.
-                fprintf(model, "	gl_normal_3f(");
-                fprintf(model, "    %9.4f, %9.4f, %9.4f);\n", normal[0][X], normal[0][Y], normal[0][Z]);
-                for (int i = 0; i < 3; i++) {
-                    fprintf(model, "	gl_vertex_3f(");
-                    fprintf(model, "   %9.4f, %9.4f, %9.4f);\n", v[i][X], v[i][Y], v[i][Z]);
-                }
+                mesh.add_triangle(v, normal[0], rgb);
             }
         }
-        fprintf(model, "	gl_end();\n");
-        fprintf(model, "	gl_end_list();\n");
-        fprintf(model, "}\n");
-        fprintf(model, "}\n");
-        fprintf(model, "\n");
-        fprintf(model, "#endif");
-        fclose(model);
+        fprintf(stderr, "%u triangles, %u vertices\n", (unsigned int) mesh.get_triangle_count(), (unsigned int) mesh.get_vertex_count());
+        return mesh.save(filename);
     }
 }
 
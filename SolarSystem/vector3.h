@@ -5,51 +5,51 @@
 #include <cassert>
 #include <cmath>
 
+#include "simd.h"
+
 using namespace std;
 
 namespace util {
     template <class T>
     class vector3 {
     private:
-        T x, y, z;
+        T v[3];
 
     public:
-        vector3(const T &x_param = T(), const T &y_param = T(), const T &z_param = T())
-        :x(x_param), y(y_param), z(z_param) {
+        vector3(const T &x_param = T(), const T &y_param = T(), const T &z_param = T()) {
+            v[0] = x_param, v[1] = y_param, v[2] = z_param;
         }
 
         T &get_x() {
-            return x;
+            return v[0];
         }
 
         const T get_x() const {
-            return x;
+            return v[0];
         }
 
         T &get_y() {
-            return y;
+            return v[1];
         }
 
         const T get_y() const {
-            return y;
+            return v[1];
         }
 
         T &get_z() {
-            return z;
+            return v[2];
         }
 
         const T get_z() const {
-            return z;
+            return v[2];
         }
 
         void set(const T &x, const T &y, const T &z) {
-            this->x = x;
-            this->y = y;
-            this->z = z;
+            v[0] = x, v[1] = y, v[2] = z;
         }
 
-        vector3<T> operator -() {
-            return vector3<T>(-x, -y, -z);
+        vector3<T> operator -() const {
+            return vector3<T>(-v[0], -v[1], -v[2]);
         }
 
         /**
@@ -61,88 +61,93 @@ namespace util {
          *			a copy of addition
          */
         vector3<T> operator +(const vector3<T> &o) const {
-            return vector3<T>(x + o.x, y + o.y, z + o.z);
+            return vector3<T>(v[0] + o.v[0], v[1] + o.v[1], v[2] + o.v[2]);
         }
 
         vector3<T> &operator += (const vector3<T> &o) {
-            x += o.x, y += o.y, z += o.z;
+            v[0] += o.v[0], v[1] += o.v[1], v[2] += o.v[2];
             return *this;
         }
 
         vector3<T> operator -(const vector3<T> &o) const {
-            return vector3<T>(x - o.x, y - o.y, z - o.z);
+            return vector3<T>(v[0] - o.v[0], v[1] - o.v[1], v[2] - o.v[2]);
         };
 
         vector3<T> &operator -= (const vector3<T> &o) {
-            x -= o.x, y -= o.y, z -= o.z;
+            v[0] -= o.v[0], v[1] -= o.v[1], v[2] -= o.v[2];
             return *this;
         }
 
         vector3<T> operator *(const vector3<T> &o) const {
-            return vector3<T>(x * o.x, y * o.y, z * o.z);
+            return vector3<T>(v[0] * o.v[0], v[1] * o.v[1], v[2] * o.v[2]);
         }
 
         vector3<T> &operator *= (const vector3<T> &o) {
-            x *= o.x, y *= o.y, z *= o.z;
+            v[0] *= o.v[0], v[1] *= o.v[1], v[2] *= o.v[2];
             return *this;
         }
 
         vector3<T> operator *(const T &scalar) const {
-            return vector3<T>(x * scalar, y * scalar, z * scalar);
+            return vector3<T>(v[0] * scalar, v[1] * scalar, v[2] * scalar);
         }
 
         vector3<T> &operator *= (const T &scalar) {
-            x *= scalar, y *= scalar, z *= scalar;
+            v[0] *= scalar, v[1] *= scalar, v[2] *= scalar;
             return *this;
         }
 
         T dot(const vector3<T> &o) const {
-            return (x * o.x + y * o.y + z * o.z);
+            return (v[0] * o.v[0] + v[1] * o.v[1] + v[2] * o.v[2]);
         }
 
         vector3<T> operator /(const T &scalar) const {
-            return vector3<T>(x / scalar, y / scalar, z / scalar);
+            return vector3<T>(v[0] / scalar, v[1] / scalar, v[2] / scalar);
         }
 
         vector3<T> &operator /= (const T &scalar) {
-            x /= scalar, y /= scalar, z /= scalar;
+            v[0] /= scalar, v[1] /= scalar, v[2] /= scalar;
             return *this;
         }
 
         vector3<T> operator ^(const vector3<T> &o) const {
-            return vector3<T>(
-                    (y * o.z) - (o.y * z),
-                    (z * o.x) - (o.z * x),
-                    (x * o.y) - (o.x * y));
+            return cross(o);
         }
 
         vector3<T> cross(const vector3<T> &o) const {
             return vector3<T>(
-                    (y * o.z) - (o.y * z),
-                    (z * o.x) - (o.z * x),
-                    (x * o.y) - (o.x * y));
+                    (v[1] * o.v[2]) - (o.v[1] * v[2]),
+                    (v[2] * o.v[0]) - (o.v[2] * v[0]),
+                    (v[0] * o.v[1]) - (o.v[0] * v[1]));
         }
 
+        /**
+         * Unit vector in the same direction, the zero vector stays zero
+         */
         vector3<T> normal() const {
-            return (*this / length());
+            T scalar = length();
+            if (scalar == 0) {
+                return *this;
+            }
+            return (*this / scalar);
         }
 
         void normalize() {
             T scalar = length();
-            x /= scalar, y /= scalar, z /= scalar;
+            if (scalar == 0) {
+                return;
+            }
+            v[0] /= scalar, v[1] /= scalar, v[2] /= scalar;
         }
 
         T length() const {
-            return sqrt(x * x + y * y + z * z);
+            return sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
         }
 
+        /**
+         * Angle between the two vectors in radians
+         */
         const T angle(const vector3<T> &o) const {
-            const T dot = normal() * o.normal();
-            if (dot == 0) {
-                return 0;
-            }
-
-            T t = (*this * o) / dot;
+            T t = normal().dot(o.normal());
             if (t > 1.0) {
                 t = 1.0;
             } else if (t < -1.0) {
@@ -152,52 +157,243 @@ namespace util {
         }
 
         vector3<T> orthogonal() const {
-            vector3<T> temp(1, y, z);
-            if (y < x && y <= z) {
-                temp = vector3<T>(x, 1, z);
-            } else if (z < x && z <= y) {
-                temp = vector3<T>(x, y, 1);
+            vector3<T> temp(1, v[1], v[2]);
+            if (v[1] < v[0] && v[1] <= v[2]) {
+                temp = vector3<T>(v[0], 1, v[2]);
+            } else if (v[2] < v[0] && v[2] <= v[1]) {
+                temp = vector3<T>(v[0], v[1], 1);
             }
             return (temp ^ *this);
         }
 
         T &operator [](const int i) {
             assert(i >= 0 && i < 3);
-            if (i == 0) {
-                return x;
-            } else if (i == 1) {
-                return y;
-            } else {
-                return z;
-            }
+            return v[i];
         }
 
         const T operator [](const int i) const {
             assert(i >= 0 && i < 3);
-            if (i == 0) {
-                return x;
-            } else if (i == 1) {
-                return y;
-            } else {
-                return z;
-            }
+            return v[i];
         }
 
-        bool operator ==(const vector3<T> &rhs) {
+        bool operator ==(const vector3<T> &rhs) const {
             return
-                    (abs(x - rhs.x) < 0.000001) &&
-                            (abs(y - rhs.y) < 0.000001) &&
-                            (abs(z - rhs.z) < 0.000001);
+                    (abs(v[0] - rhs.v[0]) < 0.000001) &&
+                            (abs(v[1] - rhs.v[1]) < 0.000001) &&
+                            (abs(v[2] - rhs.v[2]) < 0.000001);
         }
 
         void show() const {
-            cout << x << ", " << y << ", " << z;
+            cout << v[0] << ", " << v[1] << ", " << v[2];
         }
 
     public:
         friend
         ostream &operator <<(ostream &out, const vector3<T> &o) {
-            return out << o.x << ", " << o.y << ", " << o.z;
+            return out << o.v[0] << ", " << o.v[1] << ", " << o.v[2];
+        }
+    };
+
+    /**
+     * vector3<float> lives in one 4-wide register (w is kept at 0), so
+     * the arithmetic operators compile to single SSE/NEON instructions.
+     * Sums across lanes are done in x, y, z order to give the same
+     * results as the generic version.
+     */
+    template <>
+    class vector3<float> {
+    private:
+        union {
+            simd::float4 reg;
+            float v[4];
+        };
+
+    public:
+        explicit vector3(simd::float4 r) {
+            reg = r;
+        }
+
+        vector3(const float &x_param = 0.0f, const float &y_param = 0.0f, const float &z_param = 0.0f) {
+            reg = simd::set(x_param, y_param, z_param, 0.0f);
+        }
+
+        vector3(const vector3<float> &o) {
+            reg = o.reg;
+        }
+
+        vector3<float> &operator =(const vector3<float> &o) {
+            reg = o.reg;
+            return *this;
+        }
+
+        float &get_x() {
+            return v[0];
+        }
+
+        float get_x() const {
+            return v[0];
+        }
+
+        float &get_y() {
+            return v[1];
+        }
+
+        float get_y() const {
+            return v[1];
+        }
+
+        float &get_z() {
+            return v[2];
+        }
+
+        float get_z() const {
+            return v[2];
+        }
+
+        void set(const float &x, const float &y, const float &z) {
+            reg = simd::set(x, y, z, 0.0f);
+        }
+
+        simd::float4 get_simd() const {
+            return reg;
+        }
+
+        vector3<float> operator -() const {
+            return vector3<float>(simd::sub(simd::splat(0.0f), reg));
+        }
+
+        vector3<float> operator +(const vector3<float> &o) const {
+            return vector3<float>(simd::add(reg, o.reg));
+        }
+
+        vector3<float> &operator += (const vector3<float> &o) {
+            reg = simd::add(reg, o.reg);
+            return *this;
+        }
+
+        vector3<float> operator -(const vector3<float> &o) const {
+            return vector3<float>(simd::sub(reg, o.reg));
+        }
+
+        vector3<float> &operator -= (const vector3<float> &o) {
+            reg = simd::sub(reg, o.reg);
+            return *this;
+        }
+
+        vector3<float> operator *(const vector3<float> &o) const {
+            return vector3<float>(simd::mul(reg, o.reg));
+        }
+
+        vector3<float> &operator *= (const vector3<float> &o) {
+            reg = simd::mul(reg, o.reg);
+            return *this;
+        }
+
+        vector3<float> operator *(const float &scalar) const {
+            return vector3<float>(simd::mul(reg, simd::splat(scalar)));
+        }
+
+        vector3<float> &operator *= (const float &scalar) {
+            reg = simd::mul(reg, simd::splat(scalar));
+            return *this;
+        }
+
+        float dot(const vector3<float> &o) const {
+            vector3<float> p(simd::mul(reg, o.reg));
+            return p.v[0] + p.v[1] + p.v[2];
+        }
+
+        vector3<float> operator /(const float &scalar) const {
+            return vector3<float>(simd::div(reg, simd::set(scalar, scalar, scalar, 1.0f)));
+        }
+
+        vector3<float> &operator /= (const float &scalar) {
+            reg = simd::div(reg, simd::set(scalar, scalar, scalar, 1.0f));
+            return *this;
+        }
+
+        vector3<float> operator ^(const vector3<float> &o) const {
+            return cross(o);
+        }
+
+        vector3<float> cross(const vector3<float> &o) const {
+            return vector3<float>(
+                    (v[1] * o.v[2]) - (o.v[1] * v[2]),
+                    (v[2] * o.v[0]) - (o.v[2] * v[0]),
+                    (v[0] * o.v[1]) - (o.v[0] * v[1]));
+        }
+
+        /**
+         * Unit vector in the same direction, the zero vector stays zero
+         */
+        vector3<float> normal() const {
+            float scalar = length();
+            if (scalar == 0.0f) {
+                return *this;
+            }
+            return (*this / scalar);
+        }
+
+        void normalize() {
+            float scalar = length();
+            if (scalar == 0.0f) {
+                return;
+            }
+            *this /= scalar;
+        }
+
+        float length() const {
+            return sqrt(dot(*this));
+        }
+
+        /**
+         * Angle between the two vectors in radians
+         */
+        float angle(const vector3<float> &o) const {
+            float t = normal().dot(o.normal());
+            if (t > 1.0f) {
+                t = 1.0f;
+            } else if (t < -1.0f) {
+                t = -1.0f;
+            }
+            return acos(t);
+        }
+
+        vector3<float> orthogonal() const {
+            vector3<float> temp(1, v[1], v[2]);
+            if (v[1] < v[0] && v[1] <= v[2]) {
+                temp = vector3<float>(v[0], 1, v[2]);
+            } else if (v[2] < v[0] && v[2] <= v[1]) {
+                temp = vector3<float>(v[0], v[1], 1);
+            }
+            return (temp ^ *this);
+        }
+
+        float &operator [](const int i) {
+            assert(i >= 0 && i < 3);
+            return v[i];
+        }
+
+        float operator [](const int i) const {
+            assert(i >= 0 && i < 3);
+            return v[i];
+        }
+
+        bool operator ==(const vector3<float> &rhs) const {
+            return
+                    (fabsf(v[0] - rhs.v[0]) < 0.000001f) &&
+                            (fabsf(v[1] - rhs.v[1]) < 0.000001f) &&
+                            (fabsf(v[2] - rhs.v[2]) < 0.000001f);
+        }
+
+        void show() const {
+            cout << v[0] << ", " << v[1] << ", " << v[2];
+        }
+
+    public:
+        friend
+        ostream &operator <<(ostream &out, const vector3<float> &o) {
+            return out << o.v[0] << ", " << o.v[1] << ", " << o.v[2];
         }
     };
 }
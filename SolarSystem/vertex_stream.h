@@ -0,0 +1,211 @@
+#ifndef __SOLAR_SYSTEM_VERTEX_STREAM_H
+#define __SOLAR_SYSTEM_VERTEX_STREAM_H
+
+#include <cstdlib>
+#include <cstddef>
+
+#include "gl_platform.h"
+
+namespace util {
+	/**
+	 * True when the current context is GL 1.5 or newer and has vertex
+	 * buffer objects. Needs a current context; asks GL only once.
+	 */
+	inline bool has_vertex_buffers() {
+		static int supported = -1;
+		if (supported < 0) {
+			supported = 0;
+			const char *version = reinterpret_cast<const char *>(glGetString(GL_VERSION));
+			if (version != NULL) {
+				char *rest = NULL;
+				long major = strtol(version, &rest, 10);
+				long minor = (rest != NULL && *rest == '.') ? strtol(rest + 1, NULL, 10) : 0;
+				supported = (major > 1 || (major == 1 && minor >= 5)) ? 1 : 0;
+			}
+		}
+		return supported == 1;
+	}
+
+	/**
+	 * Ships a CPU vertex array to GL for glDrawArrays(). Uses a vertex
+	 * buffer object when the context is GL 1.5 or newer and plain client
+	 * arrays otherwise. data() hands back what to pass to the gl*Pointer()
+	 * calls: an offset into the bound VBO, or the CPU array itself.
+	 */
+	class vertex_stream {
+	public:
+		vertex_stream():
+			vbo(0),
+			checked(false),
+			use_vbo(false),
+			cpu(NULL) {
+		}
+
+		~vertex_stream() {
+			if (vbo != 0) {
+				glDeleteBuffers(1, &vbo);
+			}
+		}
+
+		/**
+		 * Replace the contents. Needs a current context.
+		 */
+		void upload(const void *vertices, size_t bytes) {
+			check_support();
+			cpu = static_cast<const char *>(vertices);
+			if (use_vbo) {
+				glBindBuffer(GL_ARRAY_BUFFER, vbo);
+				glBufferData(GL_ARRAY_BUFFER, bytes, vertices, GL_STREAM_DRAW);
+				glBindBuffer(GL_ARRAY_BUFFER, 0);
+			}
+		}
+
+		void bind() const {
+			if (use_vbo) {
+				glBindBuffer(GL_ARRAY_BUFFER, vbo);
+			}
+		}
+
+		void unbind() const {
+			if (use_vbo) {
+				glBindBuffer(GL_ARRAY_BUFFER, 0);
+			}
+		}
+
+		/**
+		 * Pointer argument for gl*Pointer() for a field at "offset" bytes
+		 */
+		const GLvoid *data(size_t offset) const {
+			if (use_vbo) {
+				return reinterpret_cast<const GLvoid *>(offset);
+			}
+			return cpu + offset;
+		}
+
+		bool is_vbo() const {
+			return use_vbo;
+		}
+
+	private:
+		void check_support() {
+			if (checked) {
+				return;
+			}
+			checked = true;
+			if (has_vertex_buffers()) {
+				glGenBuffers(1, &vbo);
+				use_vbo = (vbo != 0);
+			}
+		}
+
+	private:
+		GLuint vbo;
+		bool checked;
+		bool use_vbo;
+		const char *cpu;
+	};
+
+	/**
+	 * Keeps a mesh that never changes in static buffer objects, with an
+	 * optional index array, or leaves it in the mesh's own client arrays
+	 * when the context has no buffers. The arrays go to GL on the first
+	 * bind(); later calls only bind them.
+	 */
+	class static_buffers {
+	public:
+		static_buffers():
+			uploaded(false),
+			vertices(NULL),
+			indices(NULL) {
+			buffers[0] = buffers[1] = 0;
+		}
+
+		~static_buffers() {
+			if (buffers[0] != 0) {
+				glDeleteBuffers(2, buffers);
+			}
+		}
+
+		/**
+		 * Bind the mesh for the gl*Pointer() and draw calls that follow.
+		 * Needs a current context; the arrays must outlive the buffers.
+		 */
+		void bind(const void *vertex_array, size_t vertex_bytes, const void *index_array = NULL, size_t index_bytes = 0) {
+			vertices = static_cast<const char *>(vertex_array);
+			indices = index_array;
+			upload(vertex_bytes, index_bytes);
+			if (buffers[0] != 0) {
+				glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+				if (indices != NULL) {
+					glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+				}
+			}
+		}
+
+		void unbind() const {
+			if (buffers[0] != 0) {
+				if (indices != NULL) {
+					glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+				}
+				glBindBuffer(GL_ARRAY_BUFFER, 0);
+			}
+		}
+
+		/**
+		 * Pointer argument for gl*Pointer() for a field at "offset" bytes
+		 */
+		const GLvoid *vertex_data(size_t offset) const {
+			if (buffers[0] != 0) {
+				return reinterpret_cast<const GLvoid *>(offset);
+			}
+			return vertices + offset;
+		}
+
+		/**
+		 * Index argument for glDrawElements()
+		 */
+		const GLvoid *index_data() const {
+			if (buffers[0] != 0) {
+				return NULL;
+			}
+			return indices;
+		}
+
+	private:
+		void upload(size_t vertex_bytes, size_t index_bytes) {
+			if (uploaded) {
+				return;
+			}
+			uploaded = true;
+			if (!has_vertex_buffers()) {
+				return;
+			}
+			// names that stay 0 are ignored by glDeleteBuffers()
+			glGenBuffers(indices != NULL ? 2 : 1, buffers);
+			if (buffers[0] == 0) {
+				return;
+			}
+			glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+			glBufferData(GL_ARRAY_BUFFER, vertex_bytes, vertices, GL_STATIC_DRAW);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			if (indices != NULL) {
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+				glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_bytes, indices, GL_STATIC_DRAW);
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+			}
+		}
+
+	private:
+		// owns GL buffers, never copied
+		static_buffers(const static_buffers &);
+		static_buffers &operator =(const static_buffers &);
+
+	private:
+		bool uploaded;
+		GLuint buffers[2];		// vertices, indices
+		const char *vertices;
+		const void *indices;
+	};
+}
+
+#endif
@@ -3,13 +3,12 @@
 
 #include "galaxy.h"
 #include "texture.h"
+#include "fixed_timestep.h"
 
 #include <map>
 #include <utility>
 
-#include <GLUT/glut.h>
-#include <OpenGL/gl.h>
-#include <OpenGL/glu.h>
+#include "gl_platform.h"
 
 using namespace std;
 
@@ -26,9 +25,11 @@ namespace driver {
         int top_wnd_id;
         int info_wnd_id;
 
-        // timer
+        // timer, timer_delay is the frame period, the simulation
+        // step comes from galaxy::get_time_quantum()
         int idle_timer = 1;
-        int timer_delay = 40;
+        int timer_delay = 16;
+        int max_steps_per_frame = 5;
         int frame_count = 0;
         int timer_calls = 0;
         int base = 0;
@@ -41,6 +42,7 @@ namespace driver {
 // global
     auto_ptr<galaxy> controller;
     auto_ptr<texture> texture_data;
+    util::fixed_timestep sim_clock;
 
     void compile_text_list() {
         for (int i = 0; i < 256; i++) {
@@ -110,13 +112,22 @@ namespace driver {
         controller->set_viewing_volume(galaxy::viewing_mode::ORTHO, w, h);
     }
 
+    /**
+     * Run however many fixed simulation steps are due since the last
+     * frame, then draw in between the last two states
+     */
     void spin() {
-        controller->update();
+        sim_clock.set_step(controller->get_time_quantum());
+        int steps = sim_clock.advance();
+        for (int i = 0; i < steps; ++i) {
+            controller->update();
+        }
+        controller->interpolate(sim_clock.alpha());
         redisplay_all_wnd();
     }
 
     void interval_timer(int i) {
-        glutTimerFunc(controller->get_time_quantum(), interval_timer, 1);
+        glutTimerFunc(timer_delay, interval_timer, 1);
         // compute frames / second
         timer_calls++;
         if (timer_calls * timer_delay >= 1000) {
@@ -182,6 +193,20 @@ namespace driver {
         glutSetWindow(game_wnd_id);
     }
 
+    /**
+     * Queue the face images of sky texture "name" that are on disk,
+     * see util::skybox::face_file()
+     */
+    void add_sky_faces(const string &name, vector<pair<string, string> > &filenames, vector<texture::texture_type> &types) {
+        for (int f = 0; f < util::skybox::FACE_COUNT; ++f) {
+            const string face = util::skybox::face_file(name, f);
+            if (ifstream(face.c_str()).good()) {
+                filenames.push_back(make_pair(face, " "));
+                types.push_back(texture::texture_type::TEXTURE_REGULAR);
+            }
+        }
+    }
+
     unordered_map<string, unsigned> load_all_textures() {
         vector<texture::texture_type> types;
         vector<pair<string, string> > filenames;
@@ -238,6 +263,12 @@ namespace driver {
         filenames.push_back(make_pair(space_texture11, " "));
         types.push_back(texture::texture_type::TEXTURE_REGULAR);
 
+        // everything after the sun so far is a sky, each may come with
+        // its own six faces
+        for (size_t i = 1, n = filenames.size(); i < n; ++i) {
+            add_sky_faces(filenames[i].first, filenames, types);
+        }
+
         string planet_texture = "galaxy0.bmp";
         filenames.push_back(make_pair(planet_texture, " "));
         types.push_back(texture::texture_type::TEXTURE_REGULAR);
@@ -257,6 +288,7 @@ namespace driver {
         setup_windows();
         controller = auto_ptr<galaxy>(new galaxy(load_all_textures()));
         controller->generate_models();
+        sim_clock = util::fixed_timestep(controller->get_time_quantum(), max_steps_per_frame);
         glutMainLoop();
     }
 }